@@ -0,0 +1,26 @@
+/**
+ * @file Allocations.hpp
+ * @author Sasha Marie te Rehorst (sasha.marieterehorst@gmail.com)
+ * @author Gael Guinaliu (rodez.gael@gmail.com)
+ * @brief Compteur global des allocations sur le tas.
+ * @details Allocations.cpp remplace operator new / delete du programme : chaque allocation
+ * incrémente un compteur atomique. Le banc d'essai s'en sert pour vérifier qu'un pas en
+ * régime établi n'alloue rien (tampons réutilisés, plantes en réserve). Seul Spore2D_bench
+ * lie Allocations.cpp : ailleurs, count() n'est pas défini.
+ * @version 1.0
+ * @date 2026-01-16
+ */
+
+#pragma once
+
+#ifndef ALLOCATIONS_HPP
+#define ALLOCATIONS_HPP
+
+#include <cstdint>
+
+namespace Allocations {
+    /// Nombre d'allocations depuis le démarrage (tous threads confondus).
+    std::uint64_t count();
+}
+
+#endif
@@ -5,13 +5,21 @@
  * @brief Déclaration de la classe Application (Moteur principal).
  * @details Définit la classe principale qui orchestre la boucle de jeu,
  * la fenêtre SFML, et la communication entre le Modèle, la Vue (Renderer) et le HUD.
- * @version 0.5
- * @date 2026-01-05
+ * Le monde avance sur son propre thread (SimulationThread) : la boucle de l'Application ne
+ * fait que lire la dernière image publiée, et lui envoie les commandes qui modifient le monde.
+ * @version 0.6
+ * @date 2026-01-26
  */
 
 #pragma once
 
 #include <SFML/Graphics.hpp>
+#include <memory>
+#include <optional>
+#include <string>
+#include "Autosave.hpp"
+#include "SimulationThread.hpp"
+#include "../Model/Trajectory.hpp"
 #include "../View/Hud.hpp"
 #include "../View/Renderer.hpp"
 
@@ -30,8 +38,9 @@ public:
      * @details Prépare la fenêtre, initialise le HUD et le Renderer.
      * @param testMode Si true, l'application se fermera toute seule après 30 frames (pour les tests auto). 
      * Par défaut, c'est false (Mode normal).
+     * @param seed Graine du monde, fixée avant le premier peuplement (la même graine rejoue les mêmes débuts).
      */
-    Application(bool testMode = false);
+    Application(bool testMode, unsigned int seed);
 
     // -------------------------------------------------------------------------
     // BOUCLE DE JEU
@@ -46,7 +55,82 @@ public:
      */
     void run();
 
+    /**
+     * @brief Reprend une sauvegarde dans le monde affiché.
+     * @details Le monde est ensuite recadré sur la zone de simulation de la fenêtre.
+     * Pendant run(), le chargement a lieu entre deux pas : l'erreur éventuelle est seulement affichée.
+     * @return false si le fichier est illisible (le monde n'est pas modifié).
+     */
+    bool load(const std::string& path);
+
+    /**
+     * @brief Passe en relecture d'un enregistrement (la simulation n'avance plus).
+     * @details [P] pause, [1] [2] [3] vitesse x1 / x10 / x100, [-] sens de lecture,
+     * [Gauche] [Droite] 5 s en arrière / en avant, [Début] [Fin].
+     * @return false si le fichier n'est pas un enregistrement lisible.
+     */
+    bool play(const std::string& path);
+
+    /**
+     * @brief Enregistre les trajectoires du monde simulé (une image par pas) dans @p path.
+     * @return false si le fichier ne peut pas être créé.
+     */
+    bool record(const std::string& path);
+
+    /**
+     * @brief Monde de taille fixe, indépendante de la fenêtre, repeuplé à la densité de départ.
+     * @details La caméra permet ensuite de s'y déplacer : [Molette] zoom, glisser (clic gauche)
+     * pour se déplacer, [C] pour revoir le monde entier.
+     */
+    void setWorldSize(sf::Vector2f size);
+
+    /**
+     * @brief Zoom (pixels par unité du monde) sous lequel le monde est montré en densités.
+     * @details Voir Renderer::setLodThreshold (0 : jamais).
+     */
+    void setLodThreshold(float pixelsPerUnit) { m_renderer.setLodThreshold(pixelsPerUnit); }
+
 private:
+    /**
+     * @brief Bordures du monde : taille fixe (--world), sinon la zone de simulation de la fenêtre.
+     */
+    sf::FloatRect worldBounds() const;
+
+    /**
+     * @brief Cale les bordures du monde sur worldBounds().
+     */
+    void applyWorldBounds();
+
+    /**
+     * @brief Populations de départ, proportionnelles à l'aire du monde (celles de World::init sur la zone de jeu).
+     */
+    void resetEcosystem();
+
+    /**
+     * @brief Commandes de la caméra (souris, [C]) : valables en simulation comme en relecture.
+     */
+    void onCameraEvent(const sf::Event& event);
+
+    /**
+     * @brief Commandes de la relecture.
+     */
+    void onPlaybackKey(sf::Keyboard::Key key);
+
+    /**
+     * @brief Vitesse de la simulation : [1] [2] [3] x1 / x10 / x100, [4] aussi vite que possible.
+     */
+    void onSpeedKey(sf::Keyboard::Key key);
+
+    /**
+     * @brief Ligne d'état de la simulation : vitesse demandée et vitesse obtenue.
+     */
+    void showSpeed();
+
+    /**
+     * @brief Avance la tête de lecture de @p dt secondes affichées et décode l'image atteinte.
+     */
+    void updatePlayback(float dt);
+
     // -------------------------------------------------------------------------
     // MEMBRES PRIVÉS
     // -------------------------------------------------------------------------
@@ -56,6 +140,19 @@ private:
     // --- Sous-systèmes ---
     Hud m_hud;           ///< Gestionnaire de l'interface utilisateur (Menu gauche).
     Renderer m_renderer; ///< Gestionnaire du rendu de la simulation (Zone de jeu).
+    Autosave m_autosave; ///< Sauvegarde périodique en arrière-plan (AUTOSAVE_FILE).
+    double m_autosaveAt = 0.0;   ///< Dernière sauvegarde (horloge de SimulationThread, thread de simulation).
+    TrajectoryRecorder m_recorder; ///< Enregistrement en cours (--record), sinon fermé.
+    SimulationThread m_simulation; ///< Avance le monde par défaut (arrêtée avant l'enregistreur et la sauvegarde).
+    sf::Vector2f m_worldSize;      ///< Taille fixe du monde (--world), nulle : zone de jeu de la fenêtre.
+    std::optional<sf::Vector2i> m_dragFrom; ///< Dernière position de la souris pendant un glisser.
+    int m_speed = 1;               ///< Vitesse demandée à la simulation (ou SimulationThread::MAX_SPEED).
+
+    // --- Relecture (--play) ---
+    std::unique_ptr<TrajectoryPlayer> m_player; ///< Non nul : mode relecture.
+    double m_playhead = 0.0;  ///< Image visée (fractionnaire : vitesse quelconque).
+    int m_playSpeed = 1;      ///< Images enregistrées par image affichée (à 60 images/s).
+    int m_playDirection = 1;  ///< 1 en avant, -1 en arrière.
 
     // --- Drapeaux d'état ---
     bool m_isTestMode;   ///< Indique si on est en mode test (fermeture auto).
@@ -0,0 +1,75 @@
+/**
+ * @file Autosave.hpp
+ * @author Sasha Marie te Rehorst (sasha.marieterehorst@gmail.com)
+ * @author Gael Guinaliu (rodez.gael@gmail.com)
+ * @brief Sauvegarde périodique d'un monde sur un thread d'arrière-plan.
+ * @details Le thread de simulation ne fait que la capture (copie des colonnes, voir
+ * World::capture) ; l'encodage et l'écriture du fichier se font sur le thread de sauvegarde,
+ * pendant que la simulation continue. Si l'écriture précédente n'est pas finie, la demande
+ * est ignorée : une sauvegarde ne fait jamais attendre la boucle.
+ * @version 1.0
+ * @date 2026-01-18
+ */
+
+#pragma once
+
+#ifndef AUTOSAVE_HPP
+#define AUTOSAVE_HPP
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <thread>
+#include "../Model/Snapshot.hpp"
+
+class World;
+
+/**
+ * @class Autosave
+ * @brief Écrit des captures d'un monde dans un fichier, en arrière-plan.
+ */
+class Autosave {
+public:
+    /**
+     * @brief Démarre le thread de sauvegarde.
+     * @param path Fichier écrit à chaque sauvegarde (remplacé de façon atomique).
+     */
+    explicit Autosave(std::string path);
+
+    /// Termine l'écriture en cours (la dernière capture n'est pas perdue) puis arrête le thread.
+    ~Autosave();
+
+    Autosave(const Autosave&) = delete;
+    Autosave& operator=(const Autosave&) = delete;
+
+    /**
+     * @brief Capture @p world et confie l'écriture au thread de sauvegarde.
+     * @return false si l'écriture précédente est encore en cours (rien n'est capturé).
+     */
+    bool submit(const World& world);
+
+    /// Une écriture est en cours.
+    bool busy() const { return m_busy.load(std::memory_order_acquire); }
+
+    /// Sauvegardes écrites avec succès / échouées depuis le démarrage.
+    unsigned int written() const { return m_written.load(std::memory_order_relaxed); }
+    unsigned int failed() const { return m_failed.load(std::memory_order_relaxed); }
+
+    const std::string& path() const { return m_path; }
+
+private:
+    void loop();
+
+    std::string m_path;
+    WorldState m_state;              ///< Dernière capture (réutilisée : pas d'allocation en régime établi).
+    std::atomic<bool> m_busy{false}; ///< m_state appartient au thread de sauvegarde.
+    std::atomic<unsigned int> m_written{0}, m_failed{0};
+
+    std::mutex m_mutex;
+    std::condition_variable m_wake;
+    bool m_stop = false;
+    std::thread m_thread;            ///< Déclaré en dernier : démarré une fois le reste construit.
+};
+
+#endif
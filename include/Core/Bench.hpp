@@ -0,0 +1,57 @@
+/**
+ * @file Bench.hpp
+ * @author Sasha Marie te Rehorst (sasha.marieterehorst@gmail.com)
+ * @author Gael Guinaliu (rodez.gael@gmail.com)
+ * @brief Banc d'essai : mesure du coût de World::update selon la taille et la disposition.
+ * @details Scénarios à graine fixe (1k à 1M agents, disposition dense, clairsemée ou riche
+ * en requins), sans affichage. Les résultats sont écrits en JSON pour comparer deux builds.
+ * @version 1.0
+ * @date 2026-01-14
+ */
+
+#pragma once
+
+#ifndef BENCH_HPP
+#define BENCH_HPP
+
+#include <string>
+#include <vector>
+#include "../Model/PlantField.hpp"
+
+/**
+ * @struct BenchOptions
+ * @brief Paramètres du banc d'essai.
+ */
+struct BenchOptions {
+    std::vector<int> sizes = {1000, 10000, 100000, 1000000};      ///< Nombre d'agents (proies + requins).
+    std::vector<std::string> layouts = {"dense", "sparse", "sharks"}; ///< Dispositions à mesurer.
+    int repetitions = 3;        ///< Mesures par scénario (chacune sur un monde neuf).
+    long steps = 0;             ///< Pas mesurés par répétition (0 = selon la taille).
+    long warmup = -1;           ///< Pas de chauffe avant la mesure (-1 = selon la taille).
+    long maxAllocations = -1;   ///< Allocations tolérées pendant les pas mesurés (-1 = sans limite).
+    unsigned int seed = 42;     ///< Graine commune à tous les scénarios.
+    unsigned int threads = 0;   ///< Threads par monde (0 = tous les cœurs).
+    PlantModel plantModel = PlantModel::Individual; ///< Représentation des plantes de tous les scénarios.
+    std::string jsonPath;       ///< Fichier JSON de sortie (vide = sortie standard).
+    bool showHelp = false;      ///< --help demandé.
+};
+
+/**
+ * @brief Lit les options de la ligne de commande.
+ * @return false si un argument est invalide (le message d'erreur est déjà affiché).
+ */
+bool parseBenchArgs(int argc, char* argv[], BenchOptions& options);
+
+/**
+ * @brief Affiche l'aide de la ligne de commande.
+ */
+void printBenchUsage(const char* program);
+
+/**
+ * @brief Lance tous les scénarios et écrit le rapport JSON.
+ * @return Code de sortie du programme (0 = succès, 1 = fichier illisible ou allocations au-delà
+ * de maxAllocations dans une répétition).
+ */
+int runBench(const BenchOptions& options);
+
+#endif
@@ -0,0 +1,127 @@
+/**
+ * @file Config.hpp
+ * @author Sasha Marie te Rehorst (sasha.marieterehorst@gmail.com)
+ * @author Gael Guinaliu (rodez.gael@gmail.com)
+ * @brief Paramètres des espèces : une ligne de traits par stade de vie (Bactérie, Poisson, Requin).
+ * @details Les noyaux appelés pour chaque agent à chaque pas sont des templates sur leur source
+ * de traits. Avec la table par défaut, ils sont instanciés une fois par stade (Builtin<FISH>...) :
+ * chaque boucle ne traite que les agents de son stade et tous ses paramètres sont des constantes
+ * du compilateur (un stade qui ne fuit pas n'a même pas de code de fuite). Pour les expériences,
+ * une table peut être lue dans un fichier (loadStages) : les mêmes noyaux, instanciés sur Custom,
+ * traitent alors tous les stades d'une boucle et lisent la table selon le stade de chaque agent.
+ * @version 1.0
+ * @date 2026-01-27
+ */
+
+#pragma once
+
+#ifndef CONFIG_HPP
+#define CONFIG_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace Config {
+    // Stades (colonne Population::level)
+    constexpr std::uint8_t BACTERIA = 1;
+    constexpr std::uint8_t FISH = 2;
+    constexpr std::uint8_t SHARK = 3;
+    constexpr std::size_t STAGE_COUNT = 4; ///< Indice = niveau (le stade 0 n'existe pas).
+    constexpr float MAX_LENGTH = 1.0e6f;   ///< Plus grand rayon ou plus grande portée accepté par loadStages (px).
+
+    /**
+     * @struct StageTraits
+     * @brief Paramètres d'un stade de vie.
+     */
+    struct StageTraits {
+        // --- Corps (pris à la naissance ou à l'évolution) ---
+        float radius;        ///< Rayon physique (px).
+        float speed;         ///< Vitesse de déplacement (px/s).
+        float birthEnergy;   ///< Énergie à la naissance.
+        float birthCooldown; ///< Attente avant la première reproduction (s).
+        float maxEnergy;     ///< Plafond d'énergie.
+
+        // --- Métabolisme et déplacement ---
+        float energyLoss;    ///< Énergie perdue par seconde.
+        float wanderRate;    ///< Errance : le cap suit sin(temps * wanderRate + graine).
+        float foodRange;     ///< Portée de la recherche de nourriture, algue ou poisson (px).
+        float fleeRange;     ///< Distance à laquelle un requin fait fuir (0 : ne fuit pas) (px).
+        float fleeBoost;     ///< Vitesse de fuite, en multiple de speed.
+        float biteRange;     ///< Portée des mâchoires (chasseurs) (px).
+
+        // --- Repas et évolution ---
+        float mealEnergy;    ///< Énergie d'un repas (algue ou poisson).
+        int mealsToEvolve;   ///< Repas avant le stade suivant (0 : stade final).
+
+        // --- Reproduction ---
+        float breedEnergy;   ///< Énergie à dépasser pour se reproduire (0 : jamais).
+        float breedCost;     ///< Énergie dépensée par chaque parent.
+        float breedCooldown; ///< Attente avant la reproduction suivante (s).
+        float mateRange;     ///< Distance maximale entre les parents (px).
+    };
+
+    using StageTable = std::array<StageTraits, STAGE_COUNT>;
+
+    /// Table par défaut (celle de toutes les simulations sans fichier de configuration).
+    inline constexpr StageTable STAGES = {{
+        // rayon vitesse énergie attente max | perte errance nourriture fuite x mâchoires | repas évol. | seuil coût attente portée
+        {0.f,  0.f,   0.f,  0.f, 0.f,   0.f, 0.f, 0.f,   0.f,   0.f, 0.f,   0.f,  0,   0.f,  0.f,  0.f,  0.f}, // (aucun)
+        {4.f,  40.f,  50.f, 3.f, 50.f,  1.0f, 0.4f, 350.f, 0.f,   0.f, 0.f,  25.f, 5,   0.f,  0.f,  0.f,  0.f}, // Bactérie
+        {8.f,  80.f,  50.f, 3.f, 100.f, 2.5f, 0.4f, 350.f, 150.f, 1.8f, 0.f, 25.f, 5,   70.f, 40.f, 6.f,  30.f}, // Poisson
+        {12.f, 100.f, 80.f, 8.f, 150.f, 4.0f, 0.3f, 500.f, 0.f,   0.f, 25.f, 60.f, 0,  100.f, 60.f, 12.f, 40.f}, // Requin
+    }};
+
+    /**
+     * @struct Builtin
+     * @brief Source de traits compilée, pour le seul stade @p Level : tout est constant.
+     * @details has() sélectionne les agents du stade ; stage() ignore son argument (l'appelant
+     * n'y passe que des agents de ce stade) et rend la ligne constexpr de STAGES.
+     */
+    template <std::uint8_t Level>
+    struct Builtin {
+        static constexpr std::uint8_t LEVEL = Level;
+        static constexpr float energyLoss = STAGES[Level].energyLoss;
+        static constexpr float wanderRate = STAGES[Level].wanderRate;
+        static constexpr float foodRange = STAGES[Level].foodRange;
+        static constexpr float fleeRange = STAGES[Level].fleeRange;
+        static constexpr float fleeBoost = STAGES[Level].fleeBoost;
+        static constexpr float biteRange = STAGES[Level].biteRange;
+        static constexpr bool FLEES = fleeRange > 0.f; ///< false : aucun code de fuite instancié.
+
+        static constexpr bool has(std::uint8_t level) { return level == Level; }
+        static constexpr const StageTraits& stage(std::uint8_t) { return STAGES[Level]; }
+        static constexpr float maxFleeRange() { return fleeRange; }
+    };
+
+    /**
+     * @struct Custom
+     * @brief Source de traits lue à l'exécution (table chargée d'un fichier), tous stades confondus.
+     */
+    struct Custom {
+        static constexpr bool FLEES = true; ///< Le stade de chaque agent décide (fleeRange nul : pas de fuite).
+
+        const StageTable& stages;
+        static constexpr bool has(std::uint8_t) { return true; }
+        const StageTraits& stage(std::uint8_t level) const { return stages[level]; }
+        float maxFleeRange() const {
+            float range = 0.f;
+            for (const StageTraits& t : stages) range = range < t.fleeRange ? t.fleeRange : range;
+            return range;
+        }
+    };
+
+    /**
+     * @brief Lit une table de traits dans @p path, en partant de STAGES.
+     * @details Une valeur par ligne, « stade.trait = valeur » (stades : bacteria, fish, shark ;
+     * traits : noms des champs de StageTraits), « # » commente la fin de ligne.
+     * Ex : « fish.speed = 95 ». Les traits absents gardent leur valeur par défaut. Les longueurs
+     * (rayon, portées) sont limitées à MAX_LENGTH : au-delà, les grilles ne sauraient plus en
+     * compter les cellules.
+     * @return false si le fichier est illisible ou invalide (message sur std::cerr, @p out intact).
+     */
+    bool loadStages(const std::string& path, StageTable& out);
+}
+
+#endif
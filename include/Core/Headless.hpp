@@ -0,0 +1,70 @@
+/**
+ * @file Headless.hpp
+ * @author Sasha Marie te Rehorst (sasha.marieterehorst@gmail.com)
+ * @author Gael Guinaliu (rodez.gael@gmail.com)
+ * @brief Mode sans affichage (batch) : simulation pilotée en ligne de commande.
+ * @details N'utilise que le module System de SFML : tourne sur des machines sans
+ * serveur X, à pas fixe et aussi vite que le processeur le permet.
+ * @version 1.0
+ * @date 2026-01-10
+ */
+
+#pragma once
+
+#ifndef HEADLESS_HPP
+#define HEADLESS_HPP
+
+#include <string>
+#include "../Model/PlantField.hpp"
+
+/**
+ * @struct HeadlessOptions
+ * @brief Paramètres d'un run sans affichage.
+ */
+struct HeadlessOptions {
+    float width = 1600.f;       ///< Largeur du monde (px).
+    float height = 1000.f;      ///< Hauteur du monde (px).
+    long steps = 3600;          ///< Nombre de pas simulés.
+    float dt = 1.f / 60.f;      ///< Pas de temps fixe (s).
+    unsigned int seed = 1;      ///< Graine du générateur aléatoire.
+    int plants = 60;            ///< Algues au départ.
+    int prey = 25;              ///< Bactéries au départ.
+    int sharks = 2;             ///< Requins au départ.
+    PlantModel plantModel = PlantModel::Individual; ///< Algues individuelles ou champ de biomasse.
+    long every = 60;            ///< Intervalle (en pas) entre deux lignes de stats (0 = fin seulement).
+    std::string csvPath;        ///< Fichier CSV de sortie (vide = sortie standard).
+    std::string tracePath;      ///< Trace Chrome des phases écrite en fin de run (vide = aucune).
+    std::string loadPath;       ///< Sauvegarde de départ au lieu d'un monde neuf (vide = init).
+    std::string savePath;       ///< Sauvegarde écrite en fin de run (vide = aucune).
+    long autosaveEvery = 0;     ///< Sauvegarde en arrière-plan dans savePath tous les N pas (0 = jamais).
+    std::string recordPath;     ///< Trajectoires enregistrées à chaque pas (vide = aucune).
+    bool checkRecord = false;   ///< Relit l'enregistrement en fin de run et le compare au monde.
+    std::string speciesPath;    ///< Traits des espèces (Config::loadStages) (vide = table compilée).
+    int runs = 1;               ///< Nombre de mondes (graines seed, seed + 1, ...).
+    unsigned int threads = 0;   ///< Threads pour les runs multiples (0 = tous les cœurs).
+    unsigned int worldThreads = 1; ///< Threads pour la mise à jour de chaque monde (0 = tous les cœurs).
+    int collisionIterations = 1;   ///< Passes de relaxation des collisions par pas.
+    bool showHelp = false;      ///< --help demandé.
+};
+
+/**
+ * @brief Lit les options de la ligne de commande.
+ * @return false si un argument est invalide (le message d'erreur est déjà affiché).
+ */
+bool parseHeadlessArgs(int argc, char* argv[], HeadlessOptions& options);
+
+/**
+ * @brief Affiche l'aide de la ligne de commande.
+ */
+void printHeadlessUsage(const char* program);
+
+/**
+ * @brief Lance la (ou les) simulation(s) sans affichage et écrit les EcosystemStats au format CSV.
+ * @details Avec runs > 1, les mondes tournent en parallèle (voir runSweep) et chaque
+ * ligne est préfixée par le numéro du run et sa graine. Les lignes sont écrites au fil
+ * du run (un seul monde) ou à la fin de chaque graine (plusieurs mondes, dans l'ordre).
+ * @return Code de sortie du programme (0 = succès).
+ */
+int runHeadless(const HeadlessOptions& options);
+
+#endif
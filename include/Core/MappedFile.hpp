@@ -0,0 +1,53 @@
+/**
+ * @file MappedFile.hpp
+ * @author Sasha Marie te Rehorst (sasha.marieterehorst@gmail.com)
+ * @author Gael Guinaliu (rodez.gael@gmail.com)
+ * @brief Fichier projeté en mémoire, en lecture seule.
+ * @details mmap sur les systèmes POSIX : seules les pages lues sont chargées, à la demande.
+ * Ailleurs, le fichier est lu en entier dans un tampon (même interface).
+ * @version 1.0
+ * @date 2026-01-20
+ */
+
+#pragma once
+
+#ifndef MAPPED_FILE_HPP
+#define MAPPED_FILE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * @class MappedFile
+ * @brief Contenu d'un fichier accessible comme un tableau d'octets.
+ */
+class MappedFile {
+public:
+    MappedFile() = default;
+    ~MappedFile() { close(); }
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    /**
+     * @brief Projette @p path (ferme le fichier précédent).
+     * @param sequential Le fichier sera lu une fois, du début à la fin (lecture anticipée).
+     * @return false si le fichier est absent, vide ou illisible.
+     */
+    bool open(const std::string& path, bool sequential = true);
+
+    void close();
+
+    const std::uint8_t* data() const { return m_data; }
+    std::size_t size() const { return m_size; }
+
+private:
+    const std::uint8_t* m_data = nullptr;
+    std::size_t m_size = 0;
+    void* m_map = nullptr;              ///< Projection mmap (nullptr : tampon ou fermé).
+    std::vector<std::uint8_t> m_buffer; ///< Copie du fichier là où mmap n'existe pas.
+};
+
+#endif
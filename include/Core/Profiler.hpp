@@ -0,0 +1,97 @@
+/**
+ * @file Profiler.hpp
+ * @author Sasha Marie te Rehorst (sasha.marieterehorst@gmail.com)
+ * @author Gael Guinaliu (rodez.gael@gmail.com)
+ * @brief Chronométrage des phases (simulation, rendu) : résumé pour le HUD et trace Chrome.
+ * @details PROFILE_SCOPE("nom") mesure la portée qui l'entoure. Chaque thread écrit dans son
+ * propre anneau, sans verrou ; les lecteurs (HUD, export) le parcourent en parallèle et
+ * écartent les entrées réécrites pendant la lecture.
+ * Sans SPORE2D_PROFILE (option CMake), la macro disparaît : aucun coût, et les fonctions
+ * de lecture renvoient des résultats vides.
+ * @version 1.0
+ * @date 2026-01-15
+ */
+
+#pragma once
+
+#ifndef PROFILER_HPP
+#define PROFILER_HPP
+
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace Profiler {
+    /// true si le chronométrage est compilé.
+#ifdef SPORE2D_PROFILE
+    constexpr bool ENABLED = true;
+#else
+    constexpr bool ENABLED = false;
+#endif
+
+    /**
+     * @struct PhaseTiming
+     * @brief Temps passé dans une phase sur la fenêtre demandée (tous threads confondus).
+     */
+    struct PhaseTiming {
+        const char* name;
+        int calls;          ///< Nombre de passages.
+        double totalMs;     ///< Temps cumulé.
+        double meanMs;      ///< Durée moyenne d'un passage.
+    };
+
+    /// Horloge monotone, en nanosecondes depuis le démarrage du programme.
+    std::int64_t nowNs();
+
+    /**
+     * @brief Enregistre un intervalle dans l'anneau du thread appelant.
+     * @param name Chaîne littérale (seul le pointeur est conservé).
+     */
+    void record(const char* name, std::int64_t startNs, std::int64_t endNs);
+
+    /**
+     * @brief Agrège les intervalles terminés depuis moins de @p windowSeconds, triés par temps cumulé.
+     */
+    std::vector<PhaseTiming> summary(double windowSeconds);
+
+    /**
+     * @brief Écrit les intervalles encore en mémoire au format trace_event de Chrome
+     * (à ouvrir dans chrome://tracing ou Perfetto).
+     */
+    void writeChromeTrace(std::ostream& out);
+
+    /// Idem dans un fichier. @return false si le fichier n'a pas pu être écrit.
+    bool writeChromeTrace(const std::string& path);
+}
+
+#ifdef SPORE2D_PROFILE
+
+/**
+ * @class ProfileScope
+ * @brief Mesure la durée de vie de l'objet (utiliser la macro PROFILE_SCOPE).
+ */
+class ProfileScope {
+public:
+    explicit ProfileScope(const char* name) : m_name(name), m_start(Profiler::nowNs()) {}
+    ~ProfileScope() { Profiler::record(m_name, m_start, Profiler::nowNs()); }
+
+    ProfileScope(const ProfileScope&) = delete;
+    ProfileScope& operator=(const ProfileScope&) = delete;
+
+private:
+    const char* m_name;
+    std::int64_t m_start;
+};
+
+#define PROFILE_CONCAT_INNER(a, b) a##b
+#define PROFILE_CONCAT(a, b) PROFILE_CONCAT_INNER(a, b)
+#define PROFILE_SCOPE(name) ProfileScope PROFILE_CONCAT(profileScope_, __LINE__)(name)
+
+#else
+
+#define PROFILE_SCOPE(name) ((void)0)
+
+#endif
+
+#endif
@@ -0,0 +1,140 @@
+/**
+ * @file SimulationThread.hpp
+ * @author Sasha Marie te Rehorst (sasha.marieterehorst@gmail.com)
+ * @author Gael Guinaliu (rodez.gael@gmail.com)
+ * @brief Simulation d'un monde sur son propre thread, découplée du rendu.
+ * @details Le thread possède le World : il l'avance à sa propre cadence et publie après chaque
+ * pas une RenderSnapshot dans un TripleBuffer (sans verrou). Le rendu lit la dernière image à
+ * la sienne, sans jamais attendre un pas lent, et un rendu lent ne ralentit plus la simulation.
+ * Tout ce qui modifie le monde (remise à zéro, chargement...) passe par post() : les commandes
+ * s'exécutent sur le thread de simulation, entre deux pas.
+ * Le pas simulé est fixe (FIXED_DT) : un à-coup ne donne plus un grand pas où les requins
+ * traversent leurs proies. À chaque tour (PUBLISH_PERIOD), un accumulateur dit combien de pas
+ * rattraper à la vitesse demandée (x1, x10, x100, ou autant que possible), dans la limite d'un
+ * budget de temps réel : le retard qui ne tient pas dans le budget est abandonné (la vitesse
+ * effective baisse) au lieu de s'accumuler jusqu'à la spirale de la mort.
+ * @version 1.1
+ * @date 2026-01-26
+ */
+
+#pragma once
+
+#ifndef SIMULATION_THREAD_HPP
+#define SIMULATION_THREAD_HPP
+
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "TripleBuffer.hpp"
+#include "../Model/RenderSnapshot.hpp"
+
+class World;
+
+/**
+ * @class SimulationThread
+ * @brief Boucle de simulation d'arrière-plan et publication des images du rendu.
+ */
+class SimulationThread {
+public:
+    static constexpr float FIXED_DT = 1.f / 60.f;        ///< Pas simulé (s), celui du mode sans affichage.
+    static constexpr double PUBLISH_PERIOD = 1.0 / 60.0; ///< Un tour (pas rattrapés puis une image) par période (s réelles).
+    static constexpr double STEP_BUDGET = 0.8 * PUBLISH_PERIOD; ///< Temps réel de calcul par tour, au plus.
+    static constexpr int MAX_SPEED = 0; ///< Vitesse : autant de pas que le budget en permet.
+
+    /// Appelé sur le thread de simulation après chaque pas (enregistrement, sauvegarde...).
+    using StepHook = std::function<void(World& world)>;
+    using Command = std::function<void(World& world)>;
+
+    explicit SimulationThread(World& world);
+
+    /// Arrête le thread (le pas en cours se termine).
+    ~SimulationThread();
+
+    SimulationThread(const SimulationThread&) = delete;
+    SimulationThread& operator=(const SimulationThread&) = delete;
+
+    /// À fixer avant start().
+    void setStepHook(StepHook hook) { m_stepHook = std::move(hook); }
+
+    /**
+     * @brief Publie une première image puis lance la boucle.
+     */
+    void start();
+
+    /**
+     * @brief Termine le pas en cours, exécute les commandes en attente et arrête la boucle.
+     */
+    void stop();
+
+    bool running() const { return m_thread.joinable(); }
+
+    /**
+     * @brief Exécute @p command sur le monde, entre deux pas (dans l'ordre d'envoi).
+     * @details Avant start() (ou après stop()), la commande s'exécute tout de suite sur l'appelant.
+     */
+    void post(Command command);
+
+    void setPaused(bool paused) { m_paused.store(paused, std::memory_order_relaxed); }
+
+    /**
+     * @brief Temps simulé par seconde réelle visé (1, 10, 100...), ou MAX_SPEED.
+     * @details Plafonné par le budget de chaque tour : voir RenderSnapshot::timeWarp pour la vitesse obtenue.
+     */
+    void setSpeed(int speed) { m_speed.store(speed, std::memory_order_relaxed); }
+
+    /// Les prochaines images portent des densités (vue d'ensemble) plutôt que des index de région.
+    void setWantDensity(bool density) { m_wantDensity.store(density, std::memory_order_relaxed); }
+
+    // -------------------------------------------------------------------------
+    // LECTURE (thread de rendu)
+    // -------------------------------------------------------------------------
+
+    /// Prend la dernière image publiée. @return true si snapshot() a changé.
+    bool acquire() { return m_snapshots.acquire(); }
+
+    /// Image lue (valide après le premier acquire() réussi).
+    const RenderSnapshot& snapshot() const { return m_snapshots.front(); }
+
+    /**
+     * @brief Fraction du chemin entre les positions de départ et d'arrivée de snapshot() à afficher.
+     * @details Le rendu a une publication de retard : il atteint l'image quand la suivante est attendue.
+     */
+    double interpolation() const;
+
+    /// Horloge monotone partagée par la publication et le rendu (s).
+    static double now();
+
+private:
+    void loop();
+    bool runCommands();
+
+    /// Pas rattrapés pendant ce tour (au moins un si l'accumulateur le demande, puis dans le budget).
+    int advance(double elapsed);
+
+    /// @param steps Pas simulés depuis la publication précédente (vitesse effective).
+    void publish(int steps);
+
+    World& m_world;
+    StepHook m_stepHook;
+    TripleBuffer<RenderSnapshot> m_snapshots;
+    bool m_publishedDensity = false;  ///< Contenu de la dernière image publiée.
+    double m_accumulator = 0.0;       ///< Temps simulé dû, pas encore calculé (s).
+    double m_stepCost = 0.0;          ///< Durée moyenne d'un pas (s réelles, moyenne glissante).
+    double m_timeWarp = 0.0;          ///< Vitesse effective (moyenne glissante), voir RenderSnapshot::timeWarp.
+
+    std::atomic<bool> m_paused{false};
+    std::atomic<int> m_speed{1};
+    std::atomic<bool> m_wantDensity{false};
+
+    std::mutex m_mutex;                ///< Protège m_commands et m_stop.
+    std::condition_variable m_wake;
+    std::vector<Command> m_commands;
+    std::vector<Command> m_running;    ///< Commandes en cours d'exécution (capacité conservée).
+    bool m_stop = false;
+    std::thread m_thread;
+};
+
+#endif
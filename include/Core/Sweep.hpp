@@ -0,0 +1,62 @@
+/**
+ * @file Sweep.hpp
+ * @author Sasha Marie te Rehorst (sasha.marieterehorst@gmail.com)
+ * @author Gael Guinaliu (rodez.gael@gmail.com)
+ * @brief Balayage de paramètres : plusieurs mondes indépendants en parallèle.
+ * @details Chaque run possède son World (état + générateur aléatoire) : les threads
+ * ne partagent rien d'autre que le compteur de travail. Un seul processus remplace
+ * les centaines de lancements nécessaires aux statistiques d'ensemble.
+ * @version 1.0
+ * @date 2026-01-11
+ */
+
+#pragma once
+
+#ifndef SWEEP_HPP
+#define SWEEP_HPP
+
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <vector>
+#include "Headless.hpp"
+#include "../Model/Stats.hpp"
+
+/**
+ * @struct StatsSample
+ * @brief Statistiques d'un monde à un pas donné.
+ */
+struct StatsSample {
+    long step;
+    EcosystemStats stats;
+};
+
+/**
+ * @struct SweepResult
+ * @brief Résultat complet d'un run.
+ */
+struct SweepResult {
+    HeadlessOptions options;          ///< Configuration du run (graine comprise).
+    std::vector<StatsSample> samples; ///< Stats tous les options.every pas (+ début et fin), sauf si envoyées à onSample.
+    float wallSeconds = 0.f;          ///< Durée réelle du run.
+    std::string error;                ///< Sauvegarde illisible ou impossible à écrire, relecture différente (vide = succès).
+};
+
+/**
+ * @brief Simule un monde du début à la fin sur le thread appelant.
+ * @param onSample Si fourni, reçoit chaque échantillon dès qu'il est pris (SweepResult::samples reste vide).
+ */
+SweepResult runWorld(const HeadlessOptions& options,
+                     const std::function<void(const StatsSample&)>& onSample = {});
+
+/**
+ * @brief Simule tous les runs en parallèle.
+ * @param threads Nombre de threads (0 = tous les cœurs).
+ * @param onFinished Si fourni, appelé avec l'indice et le résultat de chaque run dès qu'il se
+ * termine (un appel à la fois, dans l'ordre de fin, depuis le thread qui a fait le run).
+ * @return Les résultats, dans l'ordre des configurations (indépendant de l'ordonnancement).
+ */
+std::vector<SweepResult> runSweep(const std::vector<HeadlessOptions>& runs, unsigned int threads = 0,
+                                  const std::function<void(std::size_t, const SweepResult&)>& onFinished = {});
+
+#endif
@@ -0,0 +1,94 @@
+/**
+ * @file ThreadPool.hpp
+ * @author Sasha Marie te Rehorst (sasha.marieterehorst@gmail.com)
+ * @author Gael Guinaliu (rodez.gael@gmail.com)
+ * @brief Réserve de threads persistants pour découper une boucle en tranches.
+ * @details Les threads sont créés une fois et attendent du travail : un pas de simulation
+ * ne paie que le réveil, pas la création. Les tranches sont distribuées dynamiquement
+ * (compteur atomique), le thread appelant travaille aussi.
+ * @version 1.0
+ * @date 2026-01-12
+ */
+
+#pragma once
+
+#ifndef THREAD_POOL_HPP
+#define THREAD_POOL_HPP
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * @class ThreadPool
+ * @brief Exécute les tranches d'une boucle sur plusieurs threads.
+ */
+class ThreadPool {
+public:
+    /**
+     * @brief Démarre la réserve.
+     * @param threads Nombre total de threads, appelant compris (0 = tous les cœurs).
+     */
+    explicit ThreadPool(unsigned int threads = 0);
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    /// Nombre de threads qui travaillent, appelant compris.
+    unsigned int size() const { return (unsigned int)m_workers.size() + 1; }
+
+    /**
+     * @brief Appelle @p fn(chunk, begin, end) pour chaque tranche de [0, count) et attend la fin.
+     * @details Le découpage ne dépend que de @p chunkSize, jamais du nombre de threads :
+     * un tampon par tranche, fusionné dans l'ordre des tranches, donne un résultat identique
+     * quel que soit l'ordonnancement.
+     */
+    template <typename Fn>
+    void parallelFor(std::size_t count, std::size_t chunkSize, Fn fn) {
+        if (count == 0) return;
+        auto body = [&](std::size_t c) {
+            std::size_t begin = c * chunkSize;
+            fn(c, begin, std::min(count, begin + chunkSize));
+        };
+        // Référence non possédante vers le corps (il vit sur notre pile) : pas de std::function,
+        // donc aucune allocation par appel.
+        run(chunkCount(count, chunkSize),
+            {[](const void* ctx, std::size_t c) { (*static_cast<const decltype(body)*>(ctx))(c); }, &body});
+    }
+
+    /// Nombre de tranches produites par parallelFor(count, chunkSize).
+    static std::size_t chunkCount(std::size_t count, std::size_t chunkSize) {
+        return (count + chunkSize - 1) / chunkSize;
+    }
+
+private:
+    /// Travail à exécuter : call(context, tranche).
+    struct Job {
+        void (*call)(const void*, std::size_t);
+        const void* context;
+        void operator()(std::size_t c) const { call(context, c); }
+    };
+
+    void run(std::size_t chunks, const Job& job);
+    void drain(const Job& job, std::size_t chunks);
+    void workerLoop();
+
+    std::vector<std::thread> m_workers;
+
+    std::mutex m_mutex;
+    std::condition_variable m_wake;   ///< Réveille les threads quand un travail arrive.
+    std::condition_variable m_idle;   ///< Prévient l'appelant quand tout est fini.
+
+    const Job* m_job = nullptr; ///< Travail en cours (nullptr si aucun).
+    std::size_t m_chunks = 0;
+    std::atomic<std::size_t> m_next{0};   ///< Prochaine tranche à prendre.
+    std::size_t m_generation = 0;         ///< Incrémenté à chaque nouveau travail.
+    unsigned int m_active = 0;            ///< Threads encore occupés sur le travail en cours.
+    bool m_stop = false;
+};
+
+#endif
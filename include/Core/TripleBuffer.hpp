@@ -0,0 +1,81 @@
+/**
+ * @file TripleBuffer.hpp
+ * @author Sasha Marie te Rehorst (sasha.marieterehorst@gmail.com)
+ * @author Gael Guinaliu (rodez.gael@gmail.com)
+ * @brief Échange sans verrou de la dernière valeur publiée entre un écrivain et un lecteur.
+ * @details Trois emplacements : celui de l'écrivain, celui du lecteur, et celui du milieu
+ * (la dernière publication). Publier ou lire n'est qu'un échange atomique avec le milieu :
+ * aucun des deux côtés n'attend l'autre. Une publication non lue est remplacée par la suivante.
+ * @version 1.0
+ * @date 2026-01-26
+ */
+
+#pragma once
+
+#ifndef TRIPLE_BUFFER_HPP
+#define TRIPLE_BUFFER_HPP
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+/**
+ * @class TripleBuffer
+ * @brief Un écrivain, un lecteur ; @p T est réutilisé (pas d'allocation en régime établi).
+ */
+template <typename T>
+class TripleBuffer {
+public:
+    // -------------------------------------------------------------------------
+    // ÉCRIVAIN
+    // -------------------------------------------------------------------------
+
+    /// Emplacement à remplir avant publish() (personne d'autre n'y touche).
+    T& back() { return m_slots[m_back]; }
+
+    /**
+     * @brief Dernière valeur publiée par l'écrivain (lecture seule).
+     * @details Le lecteur ne fait que lire, et cet emplacement ne redevient celui de
+     * l'écrivain qu'à la publication suivante : on peut y lire en remplissant back().
+     */
+    const T& lastPublished() const { return m_slots[m_published]; }
+    bool hasPublished() const { return m_hasPublished; }
+
+    /// Rend back() visible au lecteur et prend l'ancien milieu comme nouvel emplacement.
+    void publish() {
+        m_published = m_back;
+        m_hasPublished = true;
+        m_back = m_middle.exchange((std::uint8_t)(m_back | FRESH), std::memory_order_acq_rel) & INDEX;
+    }
+
+    // -------------------------------------------------------------------------
+    // LECTEUR
+    // -------------------------------------------------------------------------
+
+    /**
+     * @brief Prend la dernière publication si elle n'a pas encore été lue.
+     * @return true si front() a changé.
+     */
+    bool acquire() {
+        if (!(m_middle.load(std::memory_order_acquire) & FRESH)) return false;
+        m_front = m_middle.exchange(m_front, std::memory_order_acq_rel) & INDEX;
+        m_hasFront = true;
+        return true;
+    }
+
+    const T& front() const { return m_slots[m_front]; }
+    bool hasFront() const { return m_hasFront; } ///< Au moins une publication lue.
+
+private:
+    static constexpr std::uint8_t INDEX = 0x3; ///< Bits de l'indice d'emplacement.
+    static constexpr std::uint8_t FRESH = 0x4; ///< Le milieu n'a pas encore été lu.
+
+    std::array<T, 3> m_slots;
+    std::atomic<std::uint8_t> m_middle{1};
+    std::uint8_t m_back = 0, m_published = 0; ///< Côté écrivain.
+    bool m_hasPublished = false;
+    std::uint8_t m_front = 2;                 ///< Côté lecteur.
+    bool m_hasFront = false;
+};
+
+#endif
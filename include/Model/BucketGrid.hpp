@@ -0,0 +1,329 @@
+/**
+ * @file BucketGrid.hpp
+ * @author Sasha Marie te Rehorst (sasha.marieterehorst@gmail.com)
+ * @author Gael Guinaliu (rodez.gael@gmail.com)
+ * @brief Index spatial incrémental (grille de seaux).
+ * @details Contrairement à SpatialGrid (reconstruite à chaque pas), cette grille est
+ * maintenue au fil de l'eau : on insère, retire ou déplace un élément à la fois.
+ * Chaque cellule range ses identifiants et ses coordonnées en colonnes (ids, xs, ys) :
+ * la recherche du plus proche y applique directement les noyaux vectorisés de Nearest.
+ * Une cellule qui se vide cède ses tableaux à la prochaine cellule qui se remplit :
+ * en régime établi, entrées et déplacements n'allouent plus rien.
+ * @version 1.1
+ * @date 2026-01-08
+ */
+
+#pragma once
+
+#ifndef BUCKET_GRID_HPP
+#define BUCKET_GRID_HPP
+
+#include <SFML/System.hpp>
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <optional>
+#include <vector>
+#include "NearestKernels.hpp"
+
+/**
+ * @class BucketGrid
+ * @brief Grille de seaux indexant des points identifiés par @p Id.
+ * @tparam Id Identifiant copiable et comparable (pointeur, indice...).
+ */
+template <typename Id>
+class BucketGrid {
+public:
+    /**
+     * @struct Entry
+     * @brief Un point indexé (résultat des requêtes).
+     */
+    struct Entry {
+        Id id;
+        float x, y;
+    };
+
+    // -------------------------------------------------------------------------
+    // CONFIGURATION
+    // -------------------------------------------------------------------------
+
+    /**
+     * @brief Redimensionne la grille et la vide.
+     * @param xMin,xMax,yMin,yMax Limites du monde.
+     * @param cellSize Taille d'une cellule (de l'ordre du rayon des requêtes fréquentes).
+     */
+    void reset(float xMin, float xMax, float yMin, float yMax, float cellSize) {
+        m_xMin = xMin; m_yMin = yMin;
+        m_cellSize = std::max(1.f, cellSize);
+        m_invCell = 1.f / m_cellSize;
+        m_cols = std::max(1, (int)std::ceil(std::max(1.f, xMax - xMin) * m_invCell));
+        m_rows = std::max(1, (int)std::ceil(std::max(1.f, yMax - yMin) * m_invCell));
+        m_cells.assign((std::size_t)m_cols * (std::size_t)m_rows, {});
+        m_occupiedSlot.assign(m_cells.size(), NONE);
+        m_occupied.clear();
+        m_spare.clear();
+        m_size = 0;
+    }
+
+    /**
+     * @brief Vide toutes les cellules (garde leur capacité).
+     */
+    void clear() {
+        for (std::uint32_t c : m_occupied) { m_cells[c].clear(); m_occupiedSlot[c] = NONE; }
+        m_occupied.clear();
+        m_size = 0;
+    }
+
+    // -------------------------------------------------------------------------
+    // MISES À JOUR INCRÉMENTALES
+    // -------------------------------------------------------------------------
+
+    /**
+     * @brief Insère @p id à la position @p p.
+     * @return La cellule où l'élément est rangé (à conserver pour le retirer / déplacer).
+     */
+    std::uint32_t insert(Id id, sf::Vector2f p) {
+        std::uint32_t c = cellOf(p);
+        Cell& cell = m_cells[c];
+        if (cell.ids.empty()) {
+            // Cellule jamais remplie : elle reprend les tableaux d'une cellule vidée
+            if (cell.ids.capacity() == 0 && !m_spare.empty()) { cell = std::move(m_spare.back()); m_spare.pop_back(); }
+            m_occupiedSlot[c] = (std::uint32_t)m_occupied.size();
+            m_occupied.push_back(c);
+        }
+        cell.ids.push_back(id); cell.xs.push_back(p.x); cell.ys.push_back(p.y);
+        m_size++;
+        return c;
+    }
+
+    /**
+     * @brief Retire l'élément @p id rangé dans la cellule @p cell.
+     * @return false si l'élément n'y était pas.
+     */
+    bool removeFromCell(Id id, std::uint32_t cell) {
+        Cell& bucket = m_cells[cell];
+        for (std::size_t i = 0; i < bucket.ids.size(); ++i) {
+            if (bucket.ids[i] == id) {
+                // Retrait par échange : O(1) après la recherche
+                bucket.ids[i] = bucket.ids.back(); bucket.ids.pop_back();
+                bucket.xs[i] = bucket.xs.back();   bucket.xs.pop_back();
+                bucket.ys[i] = bucket.ys.back();   bucket.ys.pop_back();
+                m_size--;
+                if (bucket.ids.empty()) releaseCell(cell);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /**
+     * @brief Retire l'élément @p id, indexé à la position @p p.
+     */
+    bool remove(Id id, sf::Vector2f p) { return removeFromCell(id, cellOf(p)); }
+
+    /**
+     * @brief Met à jour la position de @p id (ne change de cellule que si nécessaire).
+     * @param cell Cellule actuelle de l'élément.
+     * @return La nouvelle cellule.
+     */
+    std::uint32_t update(Id id, std::uint32_t cell, sf::Vector2f to) {
+        std::uint32_t target = cellOf(to);
+        if (target == cell) {
+            Cell& bucket = m_cells[cell];
+            for (std::size_t i = 0; i < bucket.ids.size(); ++i)
+                if (bucket.ids[i] == id) { bucket.xs[i] = to.x; bucket.ys[i] = to.y; break; }
+            return cell;
+        }
+        removeFromCell(id, cell);
+        return insert(id, to);
+    }
+
+    /**
+     * @brief Renomme un élément (ex : son indice a changé après un compactage).
+     */
+    void relabel(Id from, Id to, std::uint32_t cell) {
+        for (auto& id : m_cells[cell].ids) if (id == from) { id = to; return; }
+    }
+
+    /**
+     * @brief Cellule qui contiendrait un point en @p p.
+     */
+    std::uint32_t cellOf(sf::Vector2f p) const { return (std::uint32_t)(cellY(p.y) * m_cols + cellX(p.x)); }
+
+    // -------------------------------------------------------------------------
+    // REQUÊTES
+    // -------------------------------------------------------------------------
+
+    /**
+     * @brief Plus proche élément à moins de @p r de @p p.
+     * @details Parcours par anneaux de cellules autour du point : on s'arrête dès que
+     * l'anneau suivant est forcément plus loin que le meilleur candidat. Les cellules
+     * bien remplies sont parcourues par le noyau vectorisé Nearest::argMin, les autres
+     * (le cas courant) par une boucle directe qui donne le même résultat.
+     * @param outDistSq Reçoit la distance au carré du résultat (si non nul).
+     * @return L'entrée trouvée, ou rien.
+     */
+    std::optional<Entry> nearest(sf::Vector2f p, float r, float* outDistSq = nullptr) const {
+        return search(p, r, outDistSq, [&](const Cell& c, float& bestSq, std::optional<Entry>& best) {
+            std::uint32_t k = Nearest::NONE;
+            if (c.ids.size() >= KERNEL_MIN_POINTS) {
+                k = Nearest::argMin(c.xs.data(), c.ys.data(), c.ids.size(), p.x, p.y, bestSq);
+            } else {
+                for (std::size_t i = 0; i < c.ids.size(); ++i) {
+                    float dx = c.xs[i] - p.x, dy = c.ys[i] - p.y;
+                    float d = dx * dx + dy * dy;
+                    if (d < bestSq) { bestSq = d; k = (std::uint32_t)i; }
+                }
+            }
+            if (k != Nearest::NONE) best = Entry{c.ids[k], c.xs[k], c.ys[k]};
+        });
+    }
+
+    /**
+     * @brief Comme nearest(), en ne retenant que les éléments acceptés par @p pred (boucle scalaire).
+     */
+    template <typename Pred>
+    std::optional<Entry> nearest(sf::Vector2f p, float r, Pred pred, float* outDistSq = nullptr) const {
+        return search(p, r, outDistSq, [&](const Cell& c, float& bestSq, std::optional<Entry>& best) {
+            for (std::size_t i = 0; i < c.ids.size(); ++i) {
+                float dx = c.xs[i] - p.x, dy = c.ys[i] - p.y;
+                float d = dx * dx + dy * dy;
+                if (d < bestSq && pred(c.ids[i])) { bestSq = d; best = Entry{c.ids[i], c.xs[i], c.ys[i]}; }
+            }
+        });
+    }
+
+    /**
+     * @brief Premier élément trouvé à moins de @p r de @p p et accepté par @p pred (ordre non spécifié).
+     */
+    template <typename Pred>
+    std::optional<Entry> firstWithin(sf::Vector2f p, float r, Pred pred) const {
+        float rSq = r * r;
+        int x0 = cellX(p.x - r), x1 = cellX(p.x + r);
+        int y0 = cellY(p.y - r), y1 = cellY(p.y + r);
+        for (int y = y0; y <= y1; ++y)
+            for (int x = x0; x <= x1; ++x) {
+                const Cell& c = m_cells[(std::size_t)y * m_cols + x];
+                for (std::size_t i = 0; i < c.ids.size(); ++i) {
+                    float dx = c.xs[i] - p.x, dy = c.ys[i] - p.y;
+                    if (dx * dx + dy * dy < rSq && pred(c.ids[i])) return Entry{c.ids[i], c.xs[i], c.ys[i]};
+                }
+            }
+        return std::nullopt;
+    }
+
+    std::optional<Entry> firstWithin(sf::Vector2f p, float r) const {
+        return firstWithin(p, r, [](const Id&) { return true; });
+    }
+
+    /**
+     * @brief Appelle @p fn(entry) pour chaque élément dans les cellules touchant le disque (p, r).
+     */
+    template <typename Fn>
+    void forEachNear(sf::Vector2f p, float r, Fn fn) const {
+        forEachInBox({p.x - r, p.y - r}, {p.x + r, p.y + r}, fn);
+    }
+
+    /**
+     * @brief Appelle @p fn(entry) pour chaque élément dans les cellules touchant le rectangle [min, max].
+     */
+    template <typename Fn>
+    void forEachInBox(sf::Vector2f min, sf::Vector2f max, Fn fn) const {
+        if (m_cells.empty()) return;
+        int x0 = cellX(min.x), x1 = cellX(max.x);
+        int y0 = cellY(min.y), y1 = cellY(max.y);
+        for (int y = y0; y <= y1; ++y)
+            for (int x = x0; x <= x1; ++x) {
+                const Cell& c = m_cells[(std::size_t)y * m_cols + x];
+                for (std::size_t i = 0; i < c.ids.size(); ++i) fn(Entry{c.ids[i], c.xs[i], c.ys[i]});
+            }
+    }
+
+    std::size_t size() const { return m_size; }
+
+private:
+    /**
+     * @struct Cell
+     * @brief Contenu d'une cellule, en colonnes.
+     */
+    struct Cell {
+        std::vector<Id> ids;
+        std::vector<float> xs, ys;
+        void clear() { ids.clear(); xs.clear(); ys.clear(); }
+    };
+
+    int cellX(float x) const { return std::clamp((int)((x - m_xMin) * m_invCell), 0, m_cols - 1); }
+    int cellY(float y) const { return std::clamp((int)((y - m_yMin) * m_invCell), 0, m_rows - 1); }
+
+    static constexpr std::uint32_t NONE = 0xFFFFFFFFu;
+
+    // En dessous, l'appel du noyau (indirection + réduction des voies) coûte plus que la boucle.
+    static constexpr std::size_t KERNEL_MIN_POINTS = 8;
+
+    // Recherche du plus proche commune aux deux variantes de nearest() : @p scan parcourt une cellule.
+    template <typename Scan>
+    std::optional<Entry> search(sf::Vector2f p, float r, float* outDistSq, Scan scan) const {
+        std::optional<Entry> best;
+        float bestSq = r * r;
+        int cx = cellX(p.x), cy = cellY(p.y);
+        // Au-delà de la taille de la grille, un anneau ne contient plus aucune cellule
+        int maxRing = (int)std::ceil(std::min(r * m_invCell, (float)std::max(m_cols, m_rows))) + 1;
+
+        // Grille clairsemée : on ne visite que les cellules occupées (évite de balayer des
+        // centaines de seaux vides) quand elles sont moins nombreuses que ce que coûterait
+        // la recherche par anneaux : tout le carré au pire, et ~cellules / occupées en
+        // moyenne (surface d'un anneau atteignant la plus proche occupée).
+        std::size_t side = 2 * (std::size_t)maxRing + 1;
+        std::size_t occupied = m_occupied.size();
+        if (occupied < side * side && occupied * occupied < m_cells.size()) {
+            for (std::uint32_t c : m_occupied) scan(m_cells[c], bestSq, best);
+        } else {
+            for (int ring = 0; ring <= maxRing; ++ring) {
+                // Tout point d'un anneau >= ring est à au moins (ring - 1) cellules du point.
+                float ringDist = (ring - 1) * m_cellSize;
+                if (ring > 0 && ringDist > 0.f && ringDist * ringDist >= bestSq) break;
+                forEachCellInRing(cx, cy, ring, [&](const Cell& c) { scan(c, bestSq, best); });
+            }
+        }
+        if (best && outDistSq) *outDistSq = bestSq;
+        return best;
+    }
+
+    // Retire une cellule devenue vide de la liste des occupées (retrait par échange)
+    // et met ses tableaux de côté pour la prochaine cellule à remplir.
+    void releaseCell(std::uint32_t cell) {
+        m_spare.push_back(std::move(m_cells[cell]));
+        m_cells[cell] = Cell();
+        std::uint32_t slot = m_occupiedSlot[cell];
+        std::uint32_t last = m_occupied.back();
+        m_occupied[slot] = last;
+        m_occupiedSlot[last] = slot;
+        m_occupied.pop_back();
+        m_occupiedSlot[cell] = NONE;
+    }
+
+    // Parcourt les cellules situées exactement à la distance de Tchebychev "ring" de (cx, cy).
+    template <typename Fn>
+    void forEachCellInRing(int cx, int cy, int ring, Fn fn) const {
+        int x0 = cx - ring, x1 = cx + ring, y0 = cy - ring, y1 = cy + ring;
+        auto visit = [&](int x, int y) {
+            if (x < 0 || x >= m_cols || y < 0 || y >= m_rows) return;
+            const Cell& c = m_cells[(std::size_t)y * m_cols + x];
+            if (!c.ids.empty()) fn(c);
+        };
+        if (ring == 0) { visit(cx, cy); return; }
+        for (int x = x0; x <= x1; ++x) { visit(x, y0); visit(x, y1); }
+        for (int y = y0 + 1; y < y1; ++y) { visit(x0, y); visit(x1, y); }
+    }
+
+    float m_xMin = 0.f, m_yMin = 0.f;
+    float m_cellSize = 1.f, m_invCell = 1.f;
+    int m_cols = 1, m_rows = 1;
+    std::vector<Cell> m_cells = std::vector<Cell>(1);
+    std::vector<std::uint32_t> m_occupied;                  ///< Cellules non vides.
+    std::vector<std::uint32_t> m_occupiedSlot = {NONE};     ///< Position de chaque cellule dans m_occupied.
+    std::vector<Cell> m_spare;                              ///< Tableaux (vides) des cellules vidées.
+    std::size_t m_size = 0;
+};
+
+#endif
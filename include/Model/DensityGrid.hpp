@@ -0,0 +1,81 @@
+/**
+ * @file DensityGrid.hpp
+ * @author Sasha Marie te Rehorst (sasha.marieterehorst@gmail.com)
+ * @author Gael Guinaliu (rodez.gael@gmail.com)
+ * @brief Densité par espèce sur une grille grossière (vue d'ensemble d'un grand monde).
+ * @details Au plus RESOLUTION cellules sur le plus grand côté du monde, quelle que soit la
+ * population : la Vue en tire une texture de taille fixe quand les sprites deviennent trop petits.
+ * Les comptes sont refaits en une passe sur les colonnes (les agents bougent à chaque pas).
+ * @version 1.0
+ * @date 2026-01-25
+ */
+
+#pragma once
+
+#ifndef DENSITY_GRID_HPP
+#define DENSITY_GRID_HPP
+
+#include <SFML/System.hpp>
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <vector>
+#include "Grass.hpp"
+#include "PlantField.hpp"
+#include "Population.hpp"
+
+/**
+ * @class DensityGrid
+ * @brief Comptes par cellule et par couche (plantes, bactéries, poissons, requins).
+ */
+class DensityGrid {
+public:
+    enum Layer { PLANTS = 0, BACTERIA = 1, FISH = 2, SHARKS = 3, LAYER_COUNT };
+
+    static constexpr int RESOLUTION = 256;     ///< Cellules sur le plus grand côté du monde.
+    static constexpr float MIN_CELL_SIZE = 8.f; ///< Un petit monde n'a pas besoin de plus fin.
+
+    /**
+     * @brief Redimensionne la grille sur le monde et la vide.
+     */
+    void reset(float xMin, float xMax, float yMin, float yMax);
+
+    /// La grille a-t-elle été dimensionnée pour ces limites ?
+    bool covers(float xMin, float xMax, float yMin, float yMax) const {
+        return m_cols > 0 && xMin == m_xMin && xMax == m_xMax && yMin == m_yMin && yMax == m_yMax;
+    }
+
+    /**
+     * @brief Recompte toutes les couches (plantes individuelles ou champ selon @p model).
+     */
+    void bin(PlantModel model, const std::vector<Grass>& plants, const PlantField& field,
+             const Population& prey, const Population& sharks);
+
+    int cols() const { return m_cols; }
+    int rows() const { return m_rows; }
+    float cellSize() const { return m_cellSize; }
+    sf::Vector2f origin() const { return {m_xMin, m_yMin}; }
+
+    /// Comptes de la couche, ligne par ligne (biomasse pour les plantes du champ).
+    const std::vector<std::uint32_t>& layer(Layer l) const { return m_layers[l]; }
+    std::uint32_t peak(Layer l) const { return m_peaks[l]; } ///< Plus grand compte de la couche.
+
+    /// Change à chaque bin() : la Vue ne réécrit sa texture que si les comptes ont changé.
+    std::uint64_t version() const { return m_version; }
+
+private:
+    std::uint32_t cellOf(float x, float y) const {
+        int cx = std::clamp((int)((x - m_xMin) * m_invCell), 0, m_cols - 1);
+        int cy = std::clamp((int)((y - m_yMin) * m_invCell), 0, m_rows - 1);
+        return (std::uint32_t)(cy * m_cols + cx);
+    }
+
+    float m_xMin = 0.f, m_xMax = 0.f, m_yMin = 0.f, m_yMax = 0.f;
+    float m_cellSize = 1.f, m_invCell = 1.f;
+    int m_cols = 0, m_rows = 0;
+    std::array<std::vector<std::uint32_t>, LAYER_COUNT> m_layers;
+    std::array<std::uint32_t, LAYER_COUNT> m_peaks{};
+    std::uint64_t m_version = 0;
+};
+
+#endif
@@ -0,0 +1,124 @@
+/**
+ * @file EntityHandles.hpp
+ * @author Sasha Marie te Rehorst (sasha.marieterehorst@gmail.com)
+ * @author Gael Guinaliu (rodez.gael@gmail.com)
+ * @brief Poignées stables (identifiant + génération) vers les entités d'une Population.
+ * @details Table d'indirection à côté des colonnes (les données chaudes restent à 32 octets) :
+ * une poignée désigne un identifiant, qui connaît l'emplacement actuel de l'entité.
+ * À la mort de l'entité, la génération de l'identifiant est incrémentée (toutes les poignées
+ * existantes deviennent invalides) et l'identifiant rejoint une liste libre pour la prochaine
+ * naissance. Le compactage des colonnes ne fait que mettre à jour la table.
+ * @version 1.0
+ * @date 2026-01-22
+ */
+
+#pragma once
+
+#ifndef ENTITY_HANDLES_HPP
+#define ENTITY_HANDLES_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+/**
+ * @struct EntityHandle
+ * @brief Référence validée vers une entité : reste utilisable d'un pas à l'autre.
+ */
+struct EntityHandle {
+    static constexpr std::uint32_t NONE = 0xFFFFFFFFu;
+
+    std::uint32_t id = NONE;
+    std::uint32_t generation = 0;
+
+    bool operator==(const EntityHandle& o) const { return id == o.id && generation == o.generation; }
+    bool operator!=(const EntityHandle& o) const { return !(*this == o); }
+};
+
+/**
+ * @class EntityHandles
+ * @brief Correspondance identifiant <-> emplacement pour une Population.
+ * @details Un emplacement sans identifiant est un trou : entité morte dont la place n'a
+ * pas encore été reprise par un compactage. Les naissances sont toujours ajoutées en fin.
+ */
+class EntityHandles {
+public:
+    /// Donne une poignée à l'entité qui vient d'être ajoutée en fin de colonnes.
+    EntityHandle push() {
+        std::uint32_t id;
+        if (!m_free.empty()) {
+            id = m_free.back();
+            m_free.pop_back();
+        } else {
+            id = (std::uint32_t)m_generation.size();
+            m_generation.push_back(0);
+            m_indexOf.push_back(EntityHandle::NONE);
+        }
+        m_indexOf[id] = (std::uint32_t)m_idOf.size();
+        m_idOf.push_back(id);
+        m_live++;
+        return {id, m_generation[id]};
+    }
+
+    /// L'entité de l'emplacement @p i est morte : ses poignées deviennent invalides.
+    void release(std::uint32_t i) {
+        std::uint32_t id = m_idOf[i];
+        m_generation[id]++;
+        m_indexOf[id] = EntityHandle::NONE;
+        m_free.push_back(id);
+        m_idOf[i] = EntityHandle::NONE;
+        m_live--;
+    }
+
+    /// L'entité de l'emplacement @p from a été recopiée en @p to (compactage, @p to est un trou).
+    void move(std::uint32_t from, std::uint32_t to) {
+        std::uint32_t id = m_idOf[from];
+        m_idOf[to] = id;
+        m_idOf[from] = EntityHandle::NONE;
+        m_indexOf[id] = to;
+    }
+
+    /// Oublie les emplacements au-delà de @p n (des trous, après compactage).
+    void truncate(std::size_t n) { m_idOf.resize(n); m_layout++; }
+
+    /// Invalide toutes les poignées (init, chargement) : les générations continuent de croître.
+    void releaseAll() {
+        for (std::uint32_t i = 0; i < m_idOf.size(); ++i)
+            if (m_idOf[i] != EntityHandle::NONE) release(i);
+        m_idOf.clear();
+        m_layout++;
+    }
+
+    void reserve(std::size_t n) { m_idOf.reserve(n); m_indexOf.reserve(n); m_generation.reserve(n); m_free.reserve(n); }
+
+    // -------------------------------------------------------------------------
+    // REQUÊTES
+    // -------------------------------------------------------------------------
+
+    bool occupied(std::size_t i) const { return m_idOf[i] != EntityHandle::NONE; }
+
+    /// Poignée de l'entité vivante de l'emplacement @p i.
+    EntityHandle handleOf(std::size_t i) const { return {m_idOf[i], m_generation[m_idOf[i]]}; }
+
+    /// Emplacement actuel de l'entité, ou rien si elle est morte (ou la poignée invalide).
+    std::optional<std::size_t> resolve(EntityHandle h) const {
+        if (h.id >= m_generation.size() || m_generation[h.id] != h.generation) return std::nullopt;
+        return m_indexOf[h.id];
+    }
+
+    std::size_t live() const { return m_live; }                    ///< Entités vivantes.
+    std::size_t holes() const { return m_idOf.size() - m_live; }   ///< Emplacements à reprendre.
+    /// Change à chaque renumérotation des emplacements (compactage, releaseAll).
+    std::uint32_t layout() const { return m_layout; }
+
+private:
+    std::vector<std::uint32_t> m_idOf;        ///< Emplacement -> identifiant (NONE : trou).
+    std::vector<std::uint32_t> m_indexOf;     ///< Identifiant -> emplacement (NONE : libre).
+    std::vector<std::uint32_t> m_generation;  ///< Identifiant -> génération.
+    std::vector<std::uint32_t> m_free;        ///< Identifiants libres (LIFO).
+    std::size_t m_live = 0;
+    std::uint32_t m_layout = 0;
+};
+
+#endif
@@ -2,56 +2,102 @@
  * @file Grass.hpp
  * @author Sasha Marie te Rehorst (sasha.marieterehorst@gmail.com)
  * @author Gael Guinaliu (rodez.gael@gmail.com)
- * @brief Définition de la classe Grass (Nourriture).
- * @details Ressource statique qui apparaît aléatoirement et sert de nourriture aux moutons.
- * @version 0.5
- * @date 2026-01-05
+ * @brief Définition de la structure Grass (Nourriture).
+ * @details Ressource statique qui apparaît aléatoirement et sert de nourriture aux proies.
+ * Seules les données de simulation sont stockées : le dessin est fait par le Renderer.
+ * Les plantes vivent dans une PlantStore : emplacements fixes recyclés, aucune allocation
+ * par apparition ou consommation une fois la réserve dimensionnée.
+ * @version 2.1
+ * @date 2026-01-09
  */
 
 #pragma once
 
 // Bibliothèque utilisées
-#include <SFML/Graphics.hpp>
+#include <SFML/System.hpp>
+#include <cstdint>
+#include <utility>
+#include <vector>
+#include "BucketGrid.hpp"
 
 /**
- * @class Grass
- * @brief Représente une unité de nourriture (Herbe).
+ * @struct Grass
+ * @brief Représente une unité de nourriture (Algue).
  */
-class Grass {
-public:
-    // -------------------------------------------------------------------------
-    // CONSTRUCTEUR
-    // -------------------------------------------------------------------------
-    
+struct Grass {
     /**
-     * @brief Construit une touffe d'herbe.
-     * @param position La position (x, y) où l'herbe pousse.
+     * @brief Construit une touffe d'algue.
+     * @param position La position (x, y) où l'algue pousse.
      */
-    Grass(sf::Vector2f position);
+    Grass(sf::Vector2f position) : pos(position), alive(true) {}
 
-    // -------------------------------------------------------------------------
-    // MÉTHODES
-    // -------------------------------------------------------------------------
+    sf::Vector2f pos;       ///< Position exacte dans le monde.
+    bool alive;             ///< État de l'algue (true = visible, false = mangée).
+};
 
-    /**
-     * @brief Met à jour l'état de l'herbe.
-     * @details (Vide pour l'instant car l'herbe est statique, mais nécessaire pour l'uniformité).
-     * @param dt Temps écoulé.
-     */
-    void update(float dt);
+/**
+ * @class PlantStore
+ * @brief Réserve de plantes à emplacements fixes.
+ * @details Une plante mangée libère son emplacement (liste libre), repris par la prochaine
+ * apparition : l'indice reste un identifiant stable tant que la plante vit.
+ * Le parcours (begin / end) couvre tous les emplacements : tester Grass::alive.
+ */
+class PlantStore {
+public:
+    using Id = std::uint32_t;
 
-    /**
-     * @brief Dessine l'herbe sur la fenêtre.
-     * @details Affiche la forme principale et les détails décoratifs.
-     * @param window La fenêtre SFML cible.
-     */
-    void draw(sf::RenderWindow& window);
+    /// Ajoute une plante vivante (dans un emplacement libéré s'il en reste).
+    Id add(sf::Vector2f pos) {
+        m_live++;
+        if (!m_free.empty()) {
+            Id id = m_free.back();
+            m_free.pop_back();
+            m_slots[id] = Grass(pos);
+            return id;
+        }
+        if (m_slots.size() == m_slots.capacity()) reserve(std::max<std::size_t>(64, 2 * m_slots.size()));
+        m_slots.emplace_back(pos);
+        return (Id)(m_slots.size() - 1);
+    }
 
-    // -------------------------------------------------------------------------
-    // ATTRIBUTS PUBLICS
-    // -------------------------------------------------------------------------
-    
-    sf::Vector2f pos;       ///< Position exacte dans le monde.
-    sf::CircleShape shape;  ///< Forme géométrique de base (Cercle).
-    bool alive;             ///< État de l'herbe (true = visible, false = mangée).
-};
\ No newline at end of file
+    /// Marque la plante comme mangée et recycle son emplacement.
+    void remove(Id id) {
+        m_slots[id].alive = false;
+        m_free.push_back(id);
+        m_live--;
+    }
+
+    /// Vide la réserve (la capacité est conservée).
+    void clear() { m_slots.clear(); m_free.clear(); m_live = 0; }
+
+    /// Prépare @p n emplacements (la liste libre ne peut jamais dépasser ce nombre).
+    void reserve(std::size_t n) { m_slots.reserve(n); m_free.reserve(n); }
+
+    /// Remplace tout le contenu (chargement d'une sauvegarde) : @p freeList doit lister les emplacements morts.
+    void assign(std::vector<Grass> slots, std::vector<Id> freeList) {
+        m_slots = std::move(slots);
+        m_free = std::move(freeList);
+        m_live = m_slots.size() - m_free.size();
+    }
+
+    const std::vector<Grass>& slots() const { return m_slots; }   ///< Tous les emplacements.
+    const std::vector<Id>& freeSlots() const { return m_free; }   ///< Ordre de réutilisation (LIFO).
+
+    std::size_t size() const { return m_live; }   ///< Plantes vivantes.
+    Grass& operator[](Id id) { return m_slots[id]; }
+    const Grass& operator[](Id id) const { return m_slots[id]; }
+
+    std::vector<Grass>::const_iterator begin() const { return m_slots.begin(); }
+    std::vector<Grass>::const_iterator end() const { return m_slots.end(); }
+
+private:
+    std::vector<Grass> m_slots;
+    std::vector<Id> m_free;     ///< Emplacements libres (réutilisés en premier, LIFO).
+    std::size_t m_live = 0;
+};
+
+/**
+ * @brief Index spatial des plantes vivantes (mis à jour à chaque apparition / consommation).
+ * @details Identifiant = emplacement dans la PlantStore.
+ */
+using PlantIndex = BucketGrid<PlantStore::Id>;
@@ -0,0 +1,77 @@
+/**
+ * @file MotionKernels.hpp
+ * @author Sasha Marie te Rehorst (sasha.marieterehorst@gmail.com)
+ * @author Gael Guinaliu (rodez.gael@gmail.com)
+ * @brief Noyau vectorisé d'intégration : métabolisme, cap d'errance, déplacement et murs en une passe.
+ * @details La perception (recherches de voisins) choisit une direction par agent ; tout le
+ * reste du pas d'un agent est une suite de calculs sans branche sur ses colonnes, faite
+ * ici en une seule lecture des tableaux. Les morts (faim, écrasement contre un mur) et
+ * les trous sont des masques, pas des sauts. Comme pour NearestKernels, trois
+ * implémentations (scalaire, SSE2, AVX2) suivent Nearest::activeIsa() et donnent
+ * exactement le même résultat : même suite d'opérations IEEE, même sinus approché.
+ * @version 1.0
+ * @date 2026-01-28
+ */
+
+#pragma once
+
+#ifndef MOTION_KERNELS_HPP
+#define MOTION_KERNELS_HPP
+
+#include <SFML/System.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "../Core/Config.hpp"
+#include "Population.hpp"
+
+namespace Motion {
+    /// Marge entre le bord d'un corps et le mur (px).
+    constexpr float WALL_PADDING = 2.f;
+    /// Un corps poussé plus loin que cette distance hors du monde est écrasé (px).
+    constexpr float WALL_KILL = 50.f;
+
+    /**
+     * @struct Steering
+     * @brief Direction choisie par la perception pour chaque agent d'une tranche (indice - début).
+     */
+    struct Steering {
+        std::vector<float> x, y;           ///< Direction, en multiple de la vitesse (fuite : fleeBoost).
+        std::vector<std::uint8_t> wander;  ///< 1 : aucune cible, le noyau calcule le cap d'errance.
+
+        void reserve(std::size_t n) { x.reserve(n); y.reserve(n); wander.reserve(n); }
+        void resize(std::size_t n) { x.resize(n); y.resize(n); wander.resize(n); }
+        void set(std::size_t k, sf::Vector2f dir) { x[k] = dir.x; y[k] = dir.y; wander[k] = 0; }
+        void setWander(std::size_t k) { x[k] = 0.f; y[k] = 0.f; wander[k] = 1; }
+        /// @p n directions nulles (les trous et les agents qu'aucune boucle de stade ne touche).
+        void reset(std::size_t n) { x.assign(n, 0.f); y.assign(n, 0.f); wander.assign(n, 0); }
+    };
+
+    /**
+     * @struct Params
+     * @brief Constantes d'un pas communes à tous les stades (les traits viennent de la source de traits).
+     */
+    struct Params {
+        float dt = 0.f;
+        float time = 0.f;                                ///< Temps simulé (phase de l'errance).
+        float xMin = 0.f, xMax = 0.f, yMin = 0.f, yMax = 0.f; ///< Limites du monde.
+    };
+
+    /**
+     * @brief Fait vivre les agents [begin, end) de @p pop pendant un pas.
+     * @details Pour chaque agent vivant : perte d'énergie de son stade (mort à 0), attente
+     * de reproduction décomptée, puis déplacement de speed * dt selon @p steering[i - begin]
+     * (ou le cap d'errance sin(time * wanderRate + graine) * 6.28), et enfin les murs :
+     * bloqué à WALL_PADDING du bord, écrasé au-delà de WALL_KILL. Les trous ne bougent pas.
+     * Le cap d'errance utilise un sinus approché (série de degré 11 après réduction à
+     * [-pi/2, pi/2]) : erreur de l'ordre de l'epsilon des float, calculable sur 4 ou 8 voies.
+     * Perte d'énergie et errance viennent de @p stages : les stades de la population dans la
+     * table compilée (Config::Builtin<Level>..., constantes choisies par le masque du stade de
+     * chaque voie, sans sélection pour un seul stade), ou Config::Custom (table lue par stade).
+     */
+    template <typename... Stages>
+    void integrate(Population& pop, std::size_t begin, std::size_t end, const Steering& steering, const Params& params,
+                   const Stages&... stages);
+}
+
+#endif
@@ -0,0 +1,68 @@
+/**
+ * @file NearestKernels.hpp
+ * @author Sasha Marie te Rehorst (sasha.marieterehorst@gmail.com)
+ * @author Gael Guinaliu (rodez.gael@gmail.com)
+ * @brief Noyaux vectorisés "plus proche point" (arg-min de la distance au carré).
+ * @details Travaillent sur des tableaux x / y contigus (colonnes d'une Population, cellules
+ * d'une BucketGrid). Trois implémentations, choisies une fois au démarrage selon le
+ * processeur : AVX2 (8 voies), SSE2 (4 voies) et scalaire (référence, autres architectures).
+ * Toutes renvoient exactement le même résultat : distance minimale strictement inférieure
+ * au seuil, et plus petit indice en cas d'égalité.
+ * @version 1.0
+ * @date 2026-01-13
+ */
+
+#pragma once
+
+#ifndef NEAREST_KERNELS_HPP
+#define NEAREST_KERNELS_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+namespace Nearest {
+    /// Indice renvoyé quand aucun point n'est sous le seuil.
+    constexpr std::uint32_t NONE = 0xFFFFFFFFu;
+
+    /**
+     * @enum Isa
+     * @brief Jeux d'instructions disponibles pour les noyaux.
+     */
+    enum class Isa { Scalar, SSE2, AVX2 };
+
+    /// Meilleur jeu d'instructions supporté par ce processeur.
+    Isa detectIsa();
+
+    /// Jeu d'instructions utilisé actuellement.
+    Isa activeIsa();
+
+    /**
+     * @brief Force un jeu d'instructions (comparaisons, mesures). Ramené au meilleur supporté.
+     * @warning À appeler avant de lancer des threads de simulation.
+     */
+    void setIsa(Isa isa);
+
+    const char* isaName(Isa isa);
+
+    /**
+     * @brief Point le plus proche de (px, py) parmi les @p n points (xs[i], ys[i]).
+     * @param bestSq Seuil en entrée (distance au carré), distance trouvée en sortie.
+     * @return L'indice du point, ou NONE si aucun n'est strictement sous le seuil.
+     */
+    std::uint32_t argMin(const float* xs, const float* ys, std::size_t n, float px, float py, float& bestSq);
+
+    /**
+     * @brief argMin pour @p nq requêtes à la fois, vectorisé sur les requêtes.
+     * @details Adapté aux petits ensembles de cibles (quelques requins) interrogés par
+     * beaucoup d'agents : chaque cible est diffusée dans un registre et comparée à 4 ou 8
+     * requêtes d'un coup.
+     * @param maxSq Seuil commun (distance au carré).
+     * @param outIndex Reçoit, pour chaque requête, l'indice trouvé ou NONE.
+     * @param outDistSq Reçoit la distance au carré correspondante (maxSq si NONE).
+     */
+    void argMinBatch(const float* qx, const float* qy, std::size_t nq,
+                     const float* xs, const float* ys, std::size_t n, float maxSq,
+                     std::uint32_t* outIndex, float* outDistSq);
+}
+
+#endif
@@ -0,0 +1,133 @@
+/**
+ * @file PlantField.hpp
+ * @author Sasha Marie te Rehorst (sasha.marieterehorst@gmail.com)
+ * @author Gael Guinaliu (rodez.gael@gmail.com)
+ * @brief Champ d'algues : biomasse par cellule d'une grille dense.
+ * @details Alternative aux Grass individuelles pour les mondes très peuplés. Une algue
+ * n'est plus un objet mais une unité de biomasse : un octet par cellule en contient
+ * jusqu'à MAX_BIOMASS (2 bits par algue). Brouter décrémente la cellule de la proie,
+ * la repousse parcourt une bande de lignes par pas, et la Vue dessine le champ
+ * comme une seule texture (un pixel par cellule). Un compte des cellules occupées par
+ * bloc de BLOCK x BLOCK cellules permet à la recherche de sauter les zones broutées.
+ * @version 1.0
+ * @date 2026-01-17
+ */
+
+#pragma once
+
+#ifndef PLANT_FIELD_HPP
+#define PLANT_FIELD_HPP
+
+#include <SFML/System.hpp>
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <vector>
+
+/**
+ * @enum PlantModel
+ * @brief Représentation des plantes d'un monde.
+ */
+enum class PlantModel {
+    Individual, ///< Grass une à une (PlantStore + PlantIndex), apparition aléatoire.
+    Field       ///< Biomasse par cellule (PlantField), repousse locale.
+};
+
+/// Nom d'un modèle en ligne de commande ("individual" / "field").
+const char* plantModelName(PlantModel model);
+
+/// Modèle correspondant à @p name, ou rien s'il est inconnu.
+std::optional<PlantModel> plantModelFromName(const std::string& name);
+
+/**
+ * @class PlantField
+ * @brief Grille de biomasse avec repousse.
+ */
+class PlantField {
+public:
+    static constexpr std::uint8_t MAX_BIOMASS = 4; ///< Algues par cellule au plus.
+
+    /**
+     * @brief Redimensionne le champ. La biomasse existante est reportée sur la nouvelle grille
+     * (au centre de chaque ancienne cellule).
+     */
+    void reset(float xMin, float xMax, float yMin, float yMax, float cellSize);
+
+    /// Retire toute la biomasse (les dimensions sont conservées).
+    void clear();
+
+    /**
+     * @brief Remplace la biomasse de toutes les cellules (chargement d'une sauvegarde).
+     * @return false si @p cells n'a pas la taille du champ (rien n'est modifié).
+     */
+    bool assign(const std::vector<std::uint8_t>& cells, std::uint32_t tick);
+
+    /// Fixe la biomasse d'une cellule (relecture d'un enregistrement).
+    void set(std::uint32_t cell, std::uint8_t biomass);
+
+    /// Ajoute une algue dans la cellule de @p p. @return false si la cellule est pleine.
+    bool add(sf::Vector2f p);
+
+    /// Broute une algue de la cellule @p cell. @return false si elle était vide.
+    bool graze(std::uint32_t cell);
+
+    /**
+     * @brief Centre de la cellule non vide la plus proche, à moins de @p r de @p p.
+     * @details Recherche par anneaux de blocs, arrêtée dès que l'anneau suivant est
+     * forcément plus loin que le meilleur candidat (comme BucketGrid::nearest) ;
+     * seules les cellules des blocs occupés sont lues.
+     */
+    std::optional<sf::Vector2f> nearest(sf::Vector2f p, float r, float* outDistSq = nullptr) const;
+
+    /**
+     * @brief Fait repousser une bande de lignes (tout le champ en REGROW_PERIOD appels).
+     * @details Une cellule occupée pousse d'elle-même, une cellule vide est ensemencée par
+     * ses voisines (et, rarement, spontanément). Le tirage dépend de la cellule et du
+     * numéro d'appel, pas du générateur du monde.
+     */
+    void regrow();
+
+    std::uint32_t cellOf(sf::Vector2f p) const { return (std::uint32_t)(cellY(p.y) * m_cols + cellX(p.x)); }
+    sf::Vector2f cellCenter(std::uint32_t cell) const {
+        return {m_xMin + ((float)(cell % m_cols) + 0.5f) * m_cellSize, m_yMin + ((float)(cell / m_cols) + 0.5f) * m_cellSize};
+    }
+    std::uint8_t biomass(std::uint32_t cell) const { return m_biomass[cell]; }
+
+    std::size_t total() const { return m_total; }   ///< Algues dans tout le champ.
+    int cols() const { return m_cols; }
+    int rows() const { return m_rows; }
+    float cellSize() const { return m_cellSize; }
+    sf::Vector2f origin() const { return {m_xMin, m_yMin}; }
+    const std::vector<std::uint8_t>& cells() const { return m_biomass; } ///< Ligne par ligne.
+    std::uint32_t tick() const { return m_tick; }
+
+private:
+    int cellX(float x) const { return std::clamp((int)((x - m_xMin) * m_invCell), 0, m_cols - 1); }
+    int cellY(float y) const { return std::clamp((int)((y - m_yMin) * m_invCell), 0, m_rows - 1); }
+
+    static constexpr int REGROW_PERIOD = 30; ///< Appels à regrow() pour couvrir tout le champ.
+    static constexpr int BLOCK = 8;          ///< Côté d'un bloc, en cellules.
+
+    // Tient à jour le compte du bloc de @p cell quand elle se remplit (+1) ou se vide (-1).
+    void markBlock(std::uint32_t cell, int delta) {
+        int x = (int)(cell % m_cols) / BLOCK, y = (int)(cell / m_cols) / BLOCK;
+        m_blockCount[(std::size_t)y * m_blockCols + x] += delta;
+    }
+
+    // Parcourt les cellules non vides du bloc (bx, by) : fn(x, y).
+    template <typename Fn>
+    void forEachInBlock(int bx, int by, Fn fn) const;
+
+    float m_xMin = 0.f, m_yMin = 0.f;
+    float m_cellSize = 1.f, m_invCell = 1.f;
+    int m_cols = 1, m_rows = 1;
+    std::vector<std::uint8_t> m_biomass = std::vector<std::uint8_t>(1, 0);
+    int m_blockCols = 1, m_blockRows = 1;
+    std::vector<std::uint16_t> m_blockCount = std::vector<std::uint16_t>(1, 0); ///< Cellules occupées par bloc.
+    std::size_t m_total = 0;
+    std::uint32_t m_tick = 0; ///< Appels à regrow() depuis le dernier reset.
+};
+
+#endif
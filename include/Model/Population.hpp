@@ -0,0 +1,121 @@
+/**
+ * @file Population.hpp
+ * @author Sasha Marie te Rehorst (sasha.marieterehorst@gmail.com)
+ * @author Gael Guinaliu (rodez.gael@gmail.com)
+ * @brief Stockage en colonnes (SoA) des entités mobiles.
+ * @details Chaque composante (position, énergie, rayon...) vit dans son propre tableau
+ * contigu : les boucles de mise à jour ne lisent que les colonnes dont elles ont besoin.
+ * L'apparence (cercle, couleur) n'est plus stockée ici : elle est construite par la Vue.
+ * @version 2.0
+ * @date 2026-01-09
+ */
+
+#pragma once
+
+#ifndef POPULATION_HPP
+#define POPULATION_HPP
+
+#include <SFML/System.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/// Valeur de Population::indexCell pour une entité absente de l'index spatial.
+constexpr std::uint32_t NOT_INDEXED = 0xFFFFFFFFu;
+
+/// Position d'un emplacement libéré (trou) : hors de portée de toute recherche de voisin.
+constexpr float PARKED = 1e30f;
+
+/**
+ * @struct Population
+ * @brief Ensemble d'entités d'une même espèce, rangées par colonnes.
+ */
+struct Population {
+    // -------------------------------------------------------------------------
+    // COLONNES (données chaudes)
+    // -------------------------------------------------------------------------
+    std::vector<float> x, y;               ///< Position.
+    std::vector<float> energy;             ///< Énergie actuelle.
+    std::vector<float> radius;             ///< Rayon physique.
+    std::vector<float> speed;              ///< Vitesse de déplacement (px/s).
+    std::vector<float> cooldown;           ///< Temps restant avant de pouvoir se reproduire.
+    std::vector<std::uint8_t> level;       ///< Stade (1 = Bactérie, 2 = Poisson, 3 = Requin).
+    std::vector<std::uint8_t> eaten;       ///< Repas depuis la dernière évolution.
+    std::vector<std::uint8_t> alive;       ///< État de vie (0 / 1).
+    std::vector<std::uint8_t> seed;        ///< Graine d'errance (0..99), fixée à la naissance.
+    std::vector<std::uint32_t> indexCell;  ///< Cellule dans l'index spatial, NOT_INDEXED sinon.
+
+    /// Octets occupés par une entité (somme des colonnes).
+    static constexpr std::size_t BYTES_PER_ENTITY =
+        6 * sizeof(float) + 4 * sizeof(std::uint8_t) + sizeof(std::uint32_t);
+
+    // -------------------------------------------------------------------------
+    // GESTION DU STOCKAGE
+    // -------------------------------------------------------------------------
+
+    std::size_t size() const { return x.size(); }
+
+    /**
+     * @brief Ajoute une entité vivante en fin de colonnes.
+     * @return Son indice.
+     */
+    std::size_t add(sf::Vector2f p, float e, float r, float s, float cd, std::uint8_t lvl, std::uint8_t sd);
+
+    void reserve(std::size_t n);
+    void clear();
+
+    /**
+     * @brief Copie l'entité @p from à la place @p to (utilisé par le compactage).
+     */
+    void copy(std::size_t from, std::size_t to);
+
+    /**
+     * @brief Tronque les colonnes à @p n entités.
+     */
+    void truncate(std::size_t n);
+
+    // -------------------------------------------------------------------------
+    // MÉTHODES
+    // -------------------------------------------------------------------------
+
+    sf::Vector2f pos(std::size_t i) const { return {x[i], y[i]}; }
+
+    // Distance au carré entre l'entité i et un point
+    float distSq(std::size_t i, sf::Vector2f o) const {
+        float dx = x[i] - o.x, dy = y[i] - o.y;
+        return dx * dx + dy * dy;
+    }
+};
+
+static_assert(Population::BYTES_PER_ENTITY <= 32, "Les données chaudes d'une entité doivent tenir en 32 octets");
+
+/**
+ * @struct PopulationSnapshot
+ * @brief Tampon avant : copie figée des colonnes qu'une espèce lit chez l'autre.
+ * @details Capturé en début de pas. Pendant la mise à jour parallèle, chaque agent n'écrit
+ * que ses propres colonnes de la Population et ne voit les autres qu'à travers ce cliché :
+ * le résultat ne dépend pas de l'ordre dans lequel les threads avancent.
+ */
+struct PopulationSnapshot {
+    std::vector<float> x, y;
+    std::vector<std::uint8_t> alive;
+
+    /// Recopie les colonnes (la capacité est réutilisée d'un pas à l'autre).
+    void capture(const Population& pop) { x = pop.x; y = pop.y; alive = pop.alive; }
+    void reserve(std::size_t n) { x.reserve(n); y.reserve(n); alive.reserve(n); }
+
+    std::size_t size() const { return x.size(); }
+    sf::Vector2f pos(std::size_t i) const { return {x[i], y[i]}; }
+    float distSq(std::size_t i, sf::Vector2f o) const {
+        float dx = x[i] - o.x, dy = y[i] - o.y;
+        return dx * dx + dy * dy;
+    }
+};
+
+/**
+ * @brief Gère la collision physique entre l'entité @p i de @p a et l'entité @p j de @p b.
+ * @details Si les deux entités se chevauchent, elles se repoussent mutuellement.
+ */
+void resolveCollision(Population& a, std::size_t i, Population& b, std::size_t j);
+
+#endif
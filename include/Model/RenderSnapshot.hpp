@@ -0,0 +1,98 @@
+/**
+ * @file RenderSnapshot.hpp
+ * @author Sasha Marie te Rehorst (sasha.marieterehorst@gmail.com)
+ * @author Gael Guinaliu (rodez.gael@gmail.com)
+ * @brief Image figée d'un monde, telle que la Vue la dessine.
+ * @details Préparée par le thread de simulation après un pas, puis lue telle quelle par le
+ * thread de rendu : elle ne référence rien du World. Selon le zoom demandé, elle porte soit
+ * les colonnes affichées (position, rayon, stade, vie) et leurs index de région (sprites),
+ * soit seulement la grille de densités (vue d'ensemble, de taille fixe : pas de colonnes).
+ * Les positions de la publication précédente permettent au rendu d'interpoler entre les deux.
+ * @version 1.0
+ * @date 2026-01-26
+ */
+
+#pragma once
+
+#ifndef RENDER_SNAPSHOT_HPP
+#define RENDER_SNAPSHOT_HPP
+
+#include <SFML/System.hpp>
+#include <cstdint>
+#include <vector>
+#include "DensityGrid.hpp"
+#include "Grass.hpp"
+#include "PlantField.hpp"
+#include "Population.hpp"
+#include "SpatialGrid.hpp"
+#include "Stats.hpp"
+
+class World;
+
+/**
+ * @struct RegionIndex
+ * @brief Éléments vivants rangés par grandes cellules (rendu d'une région).
+ */
+struct RegionIndex {
+    static constexpr float CELL_SIZE = 128.f; ///< De l'ordre d'un écran au zoom maximal.
+
+    SpatialGrid grid;
+    std::vector<std::uint32_t> items; ///< Indice (colonnes ou emplacement) de chaque élément de la grille.
+
+    /// Range les entités vivantes de @p pop.
+    void build(const Population& pop, sf::Vector2f min, sf::Vector2f max);
+    /// Range les plantes vivantes de @p plants.
+    void build(const std::vector<Grass>& plants, sf::Vector2f min, sf::Vector2f max);
+
+    /**
+     * @brief Appelle @p fn(i) pour chaque élément rangé dans une cellule touchant [min, max].
+     * @details Filtre grossier : l'appelant teste encore la position.
+     */
+    template <typename Fn>
+    void forEachIn(sf::Vector2f min, sf::Vector2f max, Fn fn) const {
+        grid.forEachInBox(min.x, min.y, max.x, max.y, [&](std::uint32_t k) { fn(items[k]); });
+    }
+};
+
+/**
+ * @struct RenderSnapshot
+ * @brief Ce que le rendu lit d'un pas de simulation.
+ */
+struct RenderSnapshot {
+    // --- Monde ---
+    sf::Vector2f boundsMin, boundsMax;
+    EcosystemStats stats;
+    std::uint64_t step = 0;
+    std::uint32_t epoch = 0;
+    std::uint64_t sequence = 0; ///< Numéro de publication (1 pour la première) : change avec le contenu, même sans pas.
+    std::uint32_t preyLayout = 0, sharkLayout = 0; ///< Voir World::preyLayout().
+
+    // --- Entités (colonnes affichées seulement : x, y, radius, level, alive ; vides avec withDensity) ---
+    PlantModel plantModel = PlantModel::Individual;
+    std::vector<Grass> plants;  ///< Emplacements (tester Grass::alive).
+    PlantField field;
+    Population prey;
+    Population sharks;
+
+    /// Position de chaque entité à la publication précédente (la sienne si elle vient de naître).
+    std::vector<sf::Vector2f> preyFrom, sharksFrom;
+
+    // --- Sélection (l'un ou l'autre selon withDensity) ---
+    bool withDensity = false;
+    RegionIndex plantRegions, preyRegions, sharkRegions;
+    DensityGrid density;
+
+    // --- Horloge du rendu ---
+    double publishedAt = 0.0; ///< Instant de publication (s, horloge monotone).
+    double interval = 0.0;    ///< Écart avec la publication précédente (0 : pas d'interpolation).
+    float timeWarp = 0.f;     ///< Temps simulé par seconde réelle (moyenne glissante sur les publications).
+
+    /**
+     * @brief Remplit l'image à partir de @p world (capacités réutilisées d'une image à l'autre).
+     * @param previous Publication précédente (pour les positions de départ), ou nullptr.
+     * @param wantDensity true : densités (vue d'ensemble) ; false : index de région (sprites).
+     */
+    void capture(const World& world, const RenderSnapshot* previous, bool wantDensity, double now);
+};
+
+#endif
@@ -1,35 +1,83 @@
 /**
  * @file Sheep.hpp
- * @brief Déclaration de la classe Sheep avec gestion du niveau (Agneau/Mouton).
+ * @brief Comportement des proies : Bactérie (Niv 1) évoluant en Poisson (Niv 2).
+ * @details Les données vivent dans une Population (SoA) : chaque fonction agit sur l'indice i.
+ * Les paramètres viennent des traits de chaque stade (Config.hpp). Les noyaux appelés pour
+ * chaque agent à chaque pas sont des templates sur la source de traits : un stade de la table
+ * compilée (Config::Builtin<Level>, n'agit que sur les agents de ce stade) ou une table chargée
+ * (Config::Custom) ; les événements rares (repas, évolution, reproduction) lisent la table.
+ * Seule la perception (fuite, recherche de nourriture) est ici : métabolisme, errance et
+ * déplacement sont faits pour tous les agents d'une tranche par Motion::integrate.
  */
 
 #pragma once
-#include <SFML/Graphics.hpp>
+#include <SFML/System.hpp>
+#include <cstdint>
+#include <optional>
 #include <vector>
-#include <list>
-#include "Entity.hpp"
-
-class Grass;
-class Wolf; 
-
-class Sheep : public Entity {
-public:
-    Sheep(sf::Vector2f position);
-    void update(float dt);
-    void moveAI(float dt, const std::vector<Wolf>& wolves, const std::list<Grass>& grass, float simTime);
-    void draw(sf::RenderWindow& window);
-    
-    void eatGrass(); 
-    int getLevel() const { return m_level; }
-
-    bool canReproduce() const; 
-    void resetReproduction();  
-
-public:
-    float speed;
-
-private:
-    float m_reproCooldown;
-    int m_eatenGrass; 
-    int m_level;      
-};
\ No newline at end of file
+#include "../Core/Config.hpp"
+#include "Population.hpp"
+#include "BucketGrid.hpp"
+#include "NearestKernels.hpp"
+
+/**
+ * @brief Index spatial des poissons (niveau 2) : les seules proies chassées par les requins.
+ * @details Identifiant = indice dans la population des proies (renommé lors du compactage).
+ */
+using FishIndex = BucketGrid<std::uint32_t>;
+
+namespace Sheep {
+    /// Ajoute une Bactérie en @p position (@p wanderSeed : graine d'errance, 0..99).
+    std::size_t spawn(Population& prey, sf::Vector2f position, std::uint8_t wanderSeed, const Config::StageTable& stages);
+
+    /// Passe la proie au stade @p level (vitesse et taille de ce stade).
+    void becomeStage(Population& prey, std::size_t i, std::uint8_t level, const Config::StageTable& stages);
+
+    /**
+     * @struct Dangers
+     * @brief Requin le plus proche de chaque poisson d'une tranche (tampons réutilisés d'un pas à l'autre).
+     */
+    struct Dangers {
+        std::vector<std::uint32_t> fish;   ///< Poissons interrogés, par indice croissant.
+        std::vector<float> qx, qy;         ///< Leurs positions (requêtes contiguës).
+        std::vector<std::uint32_t> shark;  ///< Requin le plus proche à moins de 150px, ou Nearest::NONE.
+        std::vector<float> distSq;         ///< Distance au carré correspondante.
+
+        void reserve(std::size_t n) { fish.reserve(n); qx.reserve(n); qy.reserve(n); shark.reserve(n); distSq.reserve(n); }
+    };
+
+    /**
+     * @brief Cherche d'un bloc (noyau vectorisé sur les requêtes) les requins menaçant les proies
+     * de [begin, end) dont le stade fuit (fleeRange non nul) et appartient à @p traits.
+     * Vide @p out sans rien chercher si @p traits ne fuit pas (Traits::FLEES).
+     */
+    template <typename Traits>
+    void findDangers(const Population& prey, std::size_t begin, std::size_t end, const PopulationSnapshot& sharks,
+                     Dangers& out, const Traits& traits);
+
+    /**
+     * @struct Food
+     * @brief Algue visée (la plus proche à moins de foodRange), trouvée par le World selon son modèle de plantes.
+     */
+    struct Food {
+        sf::Vector2f pos;
+        float distSq;
+    };
+
+    /**
+     * @brief Direction de la proie : fuite devant le requin @p danger (Nearest::NONE si aucun), sinon vers @p food.
+     * @return La direction (en multiple de la vitesse), ou std::nullopt pour errer (cap calculé par Motion::integrate).
+     */
+    template <typename Traits>
+    std::optional<sf::Vector2f> steer(const Population& prey, std::size_t i, std::uint32_t danger,
+                                      const PopulationSnapshot& sharks, const std::optional<Food>& food, const Traits& traits);
+
+    /**
+     * @brief Nourrit la proie et gère l'évolution Bactérie -> Poisson (le passage Requin est géré par World).
+     * @return true si la proie vient de changer de stade.
+     */
+    bool eatGrass(Population& prey, std::size_t i, const Config::StageTable& stages);
+
+    bool canReproduce(const Population& prey, std::size_t i, const Config::StageTable& stages);
+    void resetReproduction(Population& prey, std::size_t i, const Config::StageTable& stages);
+}
@@ -2,8 +2,10 @@
  * @file Simulation.hpp
  * @author Sasha Marie te Rehorst
  * @author Gael Guinaliu
- * @brief Interface de la simulation marine.
- * @version 2.0
+ * @brief Interface de la simulation marine (monde par défaut).
+ * @details Ces fonctions globales relaient un World unique, celui de l'Application.
+ * Pour faire tourner plusieurs mondes, instancier directement World.
+ * @version 3.0
  */
 
 #pragma once
@@ -11,38 +13,65 @@
 #ifndef SIMULATION_HPP
 #define SIMULATION_HPP
 
-#include <SFML/Graphics.hpp>
+#include <SFML/System.hpp>
+#include <string>
+#include "Grass.hpp"
+#include "PlantField.hpp"
+#include "Population.hpp"
+#include "Stats.hpp"
+#include "World.hpp"
+
+// --- PROTOTYPES DES FONCTIONS GLOBALES ---
+// Ces fonctions doivent être déclarées ici pour être visibles par les autres fichiers .cpp
 
 /**
- * @struct EcosystemStats
- * @brief Statistiques pour le HUD.
+ * @brief Accès direct au monde par défaut.
  */
-struct EcosystemStats {
-    int plants;
-    int preyTotal;
-    int bacteria;
-    int fish;
-    int sharks;
-    int deadPrey;
-    int deadSharks;
-    int bornPrey;
-    int bornSharks;
-    float simulationTime;
-};
+World& defaultWorld();
 
 /**
- * @enum EntityType
- * @brief Types d'entités créables.
+ * @brief (Ré)initialise le monde avec les populations de départ données.
  */
-enum class EntityType { Plant, Bacteria, Fish, Shark };
+void initEcosystem(int plants = 60, int prey = 25, int sharks = 2);
 
-// --- PROTOTYPES DES FONCTIONS GLOBALES ---
-// Ces fonctions doivent être déclarées ici pour être visibles par les autres fichiers .cpp
-void initEcosystem();
+/**
+ * @brief Fixe la graine du générateur aléatoire (runs reproductibles).
+ * @details À appeler avant initEcosystem(). Si le monde n'a jamais été initialisé,
+ * le premier ecosystemUpdate() tire lui-même une graine depuis l'horloge.
+ */
+void seedEcosystem(unsigned int seed);
+
+/**
+ * @brief Nombre de threads pour la mise à jour du monde (0 = tous les cœurs).
+ */
+void setEcosystemThreads(unsigned int threads);
+
+/**
+ * @brief Représentation des plantes du monde par défaut (vide les plantes : avant initEcosystem()).
+ */
+void setPlantModel(PlantModel model);
 void setWorldBounds(float xMin, float xMax, float yMin, float yMax);
 void ecosystemUpdate(float dt);
-void ecosystemDraw(sf::RenderWindow& window);
 EcosystemStats getEcosystemStats();
 void spawnEntity(EntityType type, float x, float y);
 
+/**
+ * @brief Sauvegarde le monde par défaut (voir World::save).
+ */
+bool saveEcosystem(const std::string& path);
+
+/**
+ * @brief Remplace le monde par défaut par une sauvegarde (voir World::load).
+ * @details Les limites du monde sont celles de la sauvegarde : les réappliquer ensuite si besoin.
+ */
+bool loadEcosystem(const std::string& path);
+
+// --- ACCÈS EN LECTURE POUR LA VUE ---
+// Le modèle ne dessine plus rien : le Renderer construit l'apparence à partir de ces données.
+PlantModel getPlantModel();
+const PlantStore& getPlants();  ///< Tous les emplacements : tester Grass::alive.
+const PlantField& getPlantField();
+const Population& getPrey();    ///< Bactéries et Poissons (colonne level).
+const Population& getSharks();
+
 #endif
\ No newline at end of file
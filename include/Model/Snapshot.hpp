@@ -0,0 +1,72 @@
+/**
+ * @file Snapshot.hpp
+ * @author Sasha Marie te Rehorst (sasha.marieterehorst@gmail.com)
+ * @author Gael Guinaliu (rodez.gael@gmail.com)
+ * @brief Sauvegarde binaire d'un monde complet (format versionné).
+ * @details Un WorldState est une copie plate de tout ce qui fait avancer un monde : colonnes
+ * des populations, plantes, compteurs, temps simulé et état du générateur aléatoire. Les index
+ * spatiaux et les tampons du pas n'y figurent pas : ils sont reconstruits au chargement.
+ * Le fichier reprend les colonnes telles quelles (petit-boutiste, alignées sur 8 octets) :
+ * le chargement projette le fichier en mémoire (mmap) et recopie chaque colonne d'un bloc.
+ * @version 1.0
+ * @date 2026-01-18
+ */
+
+#pragma once
+
+#ifndef SNAPSHOT_HPP
+#define SNAPSHOT_HPP
+
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+#include "Grass.hpp"
+#include "PlantField.hpp"
+#include "Population.hpp"
+
+/**
+ * @struct WorldState
+ * @brief État persistant d'un World (voir World::capture / World::restore).
+ * @details Réutilisable d'une capture à l'autre : les colonnes gardent leur capacité.
+ */
+struct WorldState {
+    static constexpr std::uint32_t VERSION = 1; ///< Version du format de fichier.
+
+    // --- Limites et temps ---
+    float xMin = 0.f, xMax = 0.f, yMin = 0.f, yMax = 0.f;
+    float simulationTime = 0.f;
+
+    // --- Compteurs ---
+    int deadPrey = 0, deadSharks = 0;
+    int bornPrey = 0, bornSharks = 0;
+
+    // --- Entités ---
+    Population prey;                      ///< Colonne indexCell ignorée (index reconstruit).
+    Population sharks;
+    PlantModel plantModel = PlantModel::Individual;
+    std::vector<Grass> plantSlots;        ///< Modèle Individual : tous les emplacements (vivants ou non).
+    std::vector<PlantStore::Id> plantFree; ///< Modèle Individual : liste libre, dans l'ordre de réutilisation.
+    std::vector<std::uint8_t> fieldCells; ///< Modèle Field : biomasse ligne par ligne.
+    std::uint32_t fieldCols = 0, fieldRows = 0;
+    std::uint32_t fieldTick = 0;
+
+    std::mt19937 rng; ///< Générateur du monde (suite des tirages reprise à l'identique).
+};
+
+/**
+ * @brief Écrit l'état dans @p path.
+ * @details Passe par un fichier temporaire renommé à la fin : un arrêt brutal pendant
+ * l'écriture laisse la sauvegarde précédente intacte.
+ * @return false en cas d'erreur d'écriture.
+ */
+bool saveSnapshot(const std::string& path, const WorldState& state);
+
+/**
+ * @brief Relit un état écrit par saveSnapshot().
+ * @return false si le fichier est illisible, tronqué, d'une autre version ou incohérent (stade hors
+ * de la table ou d'une autre population, position ou bordure non finie) : @p state est alors indéterminé.
+ */
+bool loadSnapshot(const std::string& path, WorldState& state);
+
+#endif
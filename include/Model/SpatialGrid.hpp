@@ -0,0 +1,172 @@
+/**
+ * @file SpatialGrid.hpp
+ * @author Sasha Marie te Rehorst (sasha.marieterehorst@gmail.com)
+ * @author Gael Guinaliu (rodez.gael@gmail.com)
+ * @brief Grille uniforme (broadphase) pour les requêtes de voisinage.
+ * @details Reconstruite à chaque pas par un tri par comptage : les indices des corps
+ * sont rangés cellule par cellule dans un tableau contigu. On ne teste ensuite
+ * que les paires de cellules voisines au lieu de toutes les paires (O(n²)).
+ * @version 1.0
+ * @date 2026-01-08
+ */
+
+#pragma once
+
+#ifndef SPATIAL_GRID_HPP
+#define SPATIAL_GRID_HPP
+
+#include <SFML/System.hpp>
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @class SpatialGrid
+ * @brief Grille uniforme reconstruite à chaque pas (cellules de taille fixe).
+ */
+class SpatialGrid {
+public:
+    // -------------------------------------------------------------------------
+    // CONSTRUCTION
+    // -------------------------------------------------------------------------
+
+    /**
+     * @brief Range @p count corps dans la grille.
+     * @details La taille de cellule est au moins @p cellSize (le diamètre du plus gros corps),
+     * mais elle est agrandie si le monde produirait plus de ~4 cellules par corps,
+     * pour que la mémoire reste proportionnelle à la population.
+     * Les corps hors du monde (tolérance des murs, Motion::WALL_KILL) sont rangés dans les cellules du bord.
+     * @param xMin,xMax,yMin,yMax Limites du monde.
+     * @param cellSize Taille minimale d'une cellule.
+     * @param count Nombre de corps.
+     * @param posOf Foncteur (index -> sf::Vector2f) donnant la position du corps.
+     */
+    template <typename PosFn>
+    void build(float xMin, float xMax, float yMin, float yMax, float cellSize, std::size_t count, PosFn posOf) {
+        setup(xMin, xMax, yMin, yMax, cellSize, count);
+
+        m_cellOf.resize(count);
+        std::fill(m_cellStart.begin(), m_cellStart.end(), 0u);
+        for (std::size_t i = 0; i < count; ++i) {
+            sf::Vector2f p = posOf(i);
+            std::uint32_t c = cellIndex(cellX(p.x), cellY(p.y));
+            m_cellOf[i] = c;
+            m_cellStart[c + 1]++;
+        }
+        for (std::size_t c = 0; c < m_cellCount; ++c) m_cellStart[c + 1] += m_cellStart[c];
+
+        // Tri par comptage : m_items contient les indices rangés par cellule.
+        m_cursor.assign(m_cellStart.begin(), m_cellStart.end() - 1);
+        m_items.resize(count);
+        for (std::size_t i = 0; i < count; ++i) m_items[m_cursor[m_cellOf[i]]++] = (std::uint32_t)i;
+    }
+
+    // -------------------------------------------------------------------------
+    // REQUÊTES
+    // -------------------------------------------------------------------------
+
+    /**
+     * @brief Appelle @p fn(a, b) une seule fois pour chaque paire de corps dans des cellules voisines.
+     * @details Pour chaque cellule, on teste ses propres paires puis la moitié "avant" du
+     * voisinage (E, SO, S, SE) : chaque paire de cellules adjacentes n'est visitée qu'une fois.
+     */
+    template <typename PairFn>
+    void forEachPair(PairFn fn) const {
+        for (int cy = 0; cy < m_rows; ++cy)
+            for (int cx = 0; cx < m_cols; ++cx) pairsOfCell(cx, cy, fn);
+    }
+
+    // -------------------------------------------------------------------------
+    // COLORIAGE (résolution parallèle)
+    // -------------------------------------------------------------------------
+
+    /**
+     * @brief Dimensions de la grille en blocs de 2x2 cellules.
+     * @details Les paires d'un bloc ne touchent que ses cellules et leurs voisines "avant"
+     * (4 colonnes x 3 lignes au total). Deux blocs de même couleur (bx % 2, by % 2) sont
+     * séparés de 4 cellules : leurs paires peuvent être résolues en même temps, sans verrou.
+     */
+    int blockCols() const { return (m_cols + 1) / 2; }
+    int blockRows() const { return (m_rows + 1) / 2; }
+
+    /**
+     * @brief Comme forEachPair, limité aux paires dont la première cellule est dans le bloc (bx, by).
+     */
+    template <typename PairFn>
+    void forEachPairInBlock(int bx, int by, PairFn fn) const {
+        int x1 = std::min(2 * bx + 2, m_cols), y1 = std::min(2 * by + 2, m_rows);
+        for (int cy = 2 * by; cy < y1; ++cy)
+            for (int cx = 2 * bx; cx < x1; ++cx) pairsOfCell(cx, cy, fn);
+    }
+
+    /**
+     * @brief Appelle @p fn(index) pour chaque corps rangé dans une cellule touchant le disque (x, y, r).
+     * @details Filtre grossier : l'appelant doit encore vérifier la distance exacte.
+     */
+    template <typename Fn>
+    void forEachNear(float x, float y, float r, Fn fn) const {
+        forEachInBox(x - r, y - r, x + r, y + r, fn);
+    }
+
+    /**
+     * @brief Appelle @p fn(index) pour chaque corps rangé dans une cellule touchant le rectangle [x0, x1] x [y0, y1].
+     * @details Filtre grossier, comme forEachNear (rendu d'une région visible).
+     */
+    template <typename Fn>
+    void forEachInBox(float x0, float y0, float x1, float y1, Fn fn) const {
+        if (m_cellCount == 0) return;
+        int cx0 = cellX(x0), cx1 = cellX(x1);
+        int cy0 = cellY(y0), cy1 = cellY(y1);
+        for (int cy = cy0; cy <= cy1; ++cy)
+            for (int cx = cx0; cx <= cx1; ++cx) {
+                std::uint32_t c = cellIndex(cx, cy);
+                for (std::uint32_t i = m_cellStart[c]; i < m_cellStart[c + 1]; ++i) fn(m_items[i]);
+            }
+    }
+
+    float getCellSize() const { return m_cellSize; }
+
+private:
+    void setup(float xMin, float xMax, float yMin, float yMax, float cellSize, std::size_t count);
+
+    int cellX(float x) const { return std::clamp((int)((x - m_xMin) * m_invCell), 0, m_cols - 1); }
+    int cellY(float y) const { return std::clamp((int)((y - m_yMin) * m_invCell), 0, m_rows - 1); }
+    std::uint32_t cellIndex(int cx, int cy) const { return (std::uint32_t)(cy * m_cols + cx); }
+
+    // Paires internes à la cellule (cx, cy), puis avec la moitié "avant" de son voisinage.
+    template <typename PairFn>
+    void pairsOfCell(int cx, int cy, PairFn& fn) const {
+        static const int offsets[4][2] = { {1, 0}, {-1, 1}, {0, 1}, {1, 1} };
+        std::uint32_t c = cellIndex(cx, cy);
+        std::uint32_t begin = m_cellStart[c], end = m_cellStart[c + 1];
+        if (begin == end) return;
+
+        // Paires internes à la cellule
+        for (std::uint32_t i = begin; i < end; ++i)
+            for (std::uint32_t j = i + 1; j < end; ++j)
+                fn(m_items[i], m_items[j]);
+
+        // Paires avec les cellules voisines "avant"
+        for (const auto& o : offsets) {
+            int nx = cx + o[0], ny = cy + o[1];
+            if (nx < 0 || nx >= m_cols || ny >= m_rows) continue;
+            std::uint32_t n = cellIndex(nx, ny);
+            for (std::uint32_t i = begin; i < end; ++i)
+                for (std::uint32_t j = m_cellStart[n]; j < m_cellStart[n + 1]; ++j)
+                    fn(m_items[i], m_items[j]);
+        }
+    }
+
+    float m_xMin = 0.f, m_yMin = 0.f;
+    float m_cellSize = 1.f, m_invCell = 1.f;
+    int m_cols = 0, m_rows = 0;
+    std::size_t m_cellCount = 0;
+
+    std::vector<std::uint32_t> m_cellStart; ///< Début de chaque cellule dans m_items (taille cellules + 1).
+    std::vector<std::uint32_t> m_cursor;    ///< Curseurs d'écriture du tri par comptage.
+    std::vector<std::uint32_t> m_cellOf;    ///< Cellule de chaque corps.
+    std::vector<std::uint32_t> m_items;     ///< Indices des corps rangés par cellule.
+};
+
+#endif
@@ -0,0 +1,32 @@
+/**
+ * @file Stats.hpp
+ * @author Sasha Marie te Rehorst (sasha.marieterehorst@gmail.com)
+ * @author Gael Guinaliu (rodez.gael@gmail.com)
+ * @brief Statistiques d'un monde (HUD, exports CSV, balayages de paramètres).
+ * @version 1.0
+ * @date 2026-01-11
+ */
+
+#pragma once
+
+#ifndef STATS_HPP
+#define STATS_HPP
+
+/**
+ * @struct EcosystemStats
+ * @brief Statistiques pour le HUD.
+ */
+struct EcosystemStats {
+    int plants;
+    int preyTotal;
+    int bacteria;
+    int fish;
+    int sharks;
+    int deadPrey;
+    int deadSharks;
+    int bornPrey;
+    int bornSharks;
+    float simulationTime;
+};
+
+#endif
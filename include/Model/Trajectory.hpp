@@ -0,0 +1,179 @@
+/**
+ * @file Trajectory.hpp
+ * @author Sasha Marie te Rehorst (sasha.marieterehorst@gmail.com)
+ * @author Gael Guinaliu (rodez.gael@gmail.com)
+ * @brief Enregistrement compact des trajectoires et relecture sans simulation.
+ * @details Une image par pas de simulation. Les positions sont quantifiées (1/8 px) et codées
+ * en écart avec l'image précédente (entiers de longueur variable : un octet par axe pour un
+ * agent qui se déplace de moins de 8 px). Les naissances, morts et évolutions sont codées
+ * comme des événements : un agent mort disparaît de la liste (trous sautés), les
+ * nouveaux-nés sont ajoutés en fin (même ordre que les colonnes du monde).
+ * Une image clé (positions absolues) toutes les KEYFRAME_INTERVAL images permet de se
+ * déplacer dans l'enregistrement sans tout redécoder depuis le début.
+ * @version 1.0
+ * @date 2026-01-20
+ */
+
+#pragma once
+
+#ifndef TRAJECTORY_HPP
+#define TRAJECTORY_HPP
+
+#include <SFML/System.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+#include "../Core/MappedFile.hpp"
+#include "Grass.hpp"
+#include "PlantField.hpp"
+#include "Population.hpp"
+#include "Stats.hpp"
+
+class World;
+
+namespace Trajectory {
+    constexpr std::uint32_t VERSION = 1;
+    constexpr float SCALE = 8.f;                  ///< Unités de quantification par pixel.
+    constexpr std::size_t KEYFRAME_INTERVAL = 30; ///< Images entre deux images clés (au plus).
+
+    /**
+     * @struct Track
+     * @brief Positions quantifiées et apparence d'une espèce dans l'image courante.
+     */
+    struct Track {
+        std::vector<std::int32_t> qx, qy;
+        std::vector<std::uint8_t> level;
+        std::vector<std::uint8_t> radius;   ///< Rayon x 4 (0,25 px près).
+        std::size_t size() const { return qx.size(); }
+        void clear() { qx.clear(); qy.clear(); level.clear(); radius.clear(); }
+    };
+
+    /**
+     * @struct FrameEvents
+     * @brief Événements de la dernière image décodée.
+     */
+    struct FrameEvents {
+        std::uint32_t preyBorn = 0, preyDied = 0;
+        std::uint32_t sharksBorn = 0, sharksDied = 0;
+        std::uint32_t evolutions = 0;    ///< Changements de stade (Bactérie -> Poisson).
+        std::uint32_t sharksEvolved = 0; ///< Requins issus d'un poisson (compris dans sharksBorn).
+    };
+}
+
+/**
+ * @class TrajectoryRecorder
+ * @brief Écrit une image par appel à record(), à la suite du fichier.
+ */
+class TrajectoryRecorder {
+public:
+    /// Crée (ou remplace) le fichier. @return false s'il ne peut pas être ouvert.
+    bool open(const std::string& path);
+
+    bool isOpen() const { return m_out.is_open(); }
+
+    /**
+     * @brief Ajoute l'état de @p world (à appeler après chaque World::update).
+     * @details Une image clé est écrite au premier appel, tous les KEYFRAME_INTERVAL appels,
+     * et dès que l'image précédente ne précède pas directement celle-ci (pas manqué,
+     * init(), chargement, limites changées).
+     */
+    void record(const World& world);
+
+    void close();
+
+    std::uint64_t frames() const { return m_frames; }
+    std::uint64_t bytes() const { return m_bytes; }
+
+private:
+    void encodeKey(const World& world);
+    void encodeDelta(const World& world);
+    void encodeAgents(const Population& pop, const std::vector<std::uint32_t>& live, Trajectory::Track& track,
+                      const std::vector<std::uint32_t>& removed, std::size_t evolved, bool withEvolved);
+    void encodePlantsDelta(const World& world);
+
+    std::ofstream m_out;
+    std::vector<std::uint8_t> m_payload; ///< Image en cours de codage (capacité conservée).
+    std::vector<std::uint32_t> m_livePrey, m_liveSharks; ///< Indices des vivantes de l'image en cours.
+
+    // Image précédente (référence des écarts)
+    Trajectory::Track m_prey, m_sharks;
+    std::vector<Grass> m_plants;
+    std::vector<std::uint8_t> m_cells;
+    int m_fieldCols = 0, m_fieldRows = 0;
+    float m_bounds[4] = {0.f, 0.f, 0.f, 0.f};
+    PlantModel m_plantModel = PlantModel::Individual;
+
+    std::uint32_t m_epoch = 0;
+    std::uint64_t m_step = 0;
+    std::size_t m_sinceKey = 0;
+    std::uint64_t m_frames = 0, m_bytes = 0;
+};
+
+/**
+ * @class TrajectoryPlayer
+ * @brief Relit un enregistrement, image par image ou par sauts.
+ * @details Le fichier est projeté en mémoire ; son ouverture ne lit que les en-têtes d'image
+ * (table des images et des images clés). Les positions décodées restent entières : les
+ * colonnes affichables ne sont produites qu'à la demande (prey(), sharks()), une fois par
+ * affichage même après un saut de cent images.
+ */
+class TrajectoryPlayer {
+public:
+    /// @return false si le fichier n'est pas un enregistrement lisible (ou ne contient aucune image).
+    bool open(const std::string& path);
+
+    std::size_t frameCount() const { return m_frames.size(); }
+    std::size_t position() const { return m_position; } ///< Image décodée.
+
+    /**
+     * @brief Se place sur l'image @p frame (bornée à la dernière).
+     * @param exact false : s'arrête à l'image clé qui précède (défilement rapide, un seul décodage).
+     * @return false si une image est corrompue (la lecture reste sur la dernière image valide,
+     * redécodée depuis son image clé).
+     */
+    bool seek(std::size_t frame, bool exact = true);
+
+    // --- Contenu de l'image courante ---
+    const EcosystemStats& stats() const { return m_stats; }
+    const Trajectory::FrameEvents& events() const { return m_events; }
+    sf::Vector2f boundsMin() const { return {m_bounds[0], m_bounds[2]}; }
+    sf::Vector2f boundsMax() const { return {m_bounds[1], m_bounds[3]}; }
+    PlantModel plantModel() const { return m_plantModel; }
+    const std::vector<Grass>& plants() const { return m_plants; }
+    const PlantField& field() const { return m_field; }
+    const Population& prey() { materialize(); return m_preyView; }
+    const Population& sharks() { materialize(); return m_sharksView; }
+
+private:
+    struct FrameInfo {
+        std::size_t offset; ///< Début de l'en-tête d'image.
+        bool key;
+    };
+
+    /// @return false si l'image est corrompue : m_decoded reste faux, les pistes sont à redécoder.
+    bool decode(std::size_t frame);
+    void materialize();
+
+    MappedFile m_file;
+    std::vector<FrameInfo> m_frames;
+    std::vector<std::size_t> m_keys;      ///< Indices des images clés, croissants.
+    std::size_t m_position = 0;
+    bool m_decoded = false;
+
+    Trajectory::Track m_prey, m_sharks;
+    std::vector<std::uint8_t> m_keep;     ///< Tampon des retraits (capacité conservée).
+    std::vector<Grass> m_plants;
+    PlantField m_field;
+    std::vector<std::uint8_t> m_cells;
+    float m_bounds[4] = {0.f, 0.f, 0.f, 0.f};
+    PlantModel m_plantModel = PlantModel::Individual;
+    EcosystemStats m_stats{};
+    Trajectory::FrameEvents m_events;
+
+    Population m_preyView, m_sharksView;  ///< Colonnes affichables (x, y, rayon, stade, vie).
+    bool m_viewDirty = true;
+};
+
+#endif
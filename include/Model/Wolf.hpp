@@ -1,32 +1,45 @@
 /**
  * @file Wolf.hpp
- * @brief Déclaration de la classe Wolf avec gestion du niveau (Louveteau/Loup).
+ * @brief Comportement des requins : prédateurs des poissons.
+ * @details Les données vivent dans une Population (SoA) : chaque fonction agit sur l'indice i.
+ * Paramètres : traits du stade Requin (Config.hpp), comme pour Sheep.
  */
 
 #pragma once
-#include <SFML/Graphics.hpp>
-#include <vector>
-#include "Entity.hpp"
+#include <SFML/System.hpp>
+#include <cstdint>
+#include <optional>
+#include "../Core/Config.hpp"
+#include "Population.hpp"
+#include "Sheep.hpp"
 
-class Sheep; 
+namespace Wolf {
+    /// Ajoute un Requin en @p position (@p wanderSeed : graine d'errance, 0..99).
+    std::size_t spawn(Population& sharks, sf::Vector2f position, std::uint8_t wanderSeed, const Config::StageTable& stages);
 
-class Wolf : public Entity {
-public:
-    Wolf(sf::Vector2f position);
-    void update(float dt);
-    void moveAI(float dt, const std::vector<Sheep>& sheeps, float simTime);
-    void draw(sf::RenderWindow& window);
-    void eat(std::vector<Sheep>& sheeps);
-    bool canReproduce() const;
-    void resetReproduction();
-    
-    int getLevel() const { return m_level; }
+    /// Valeur de findPrey() quand aucun poisson n'est à portée.
+    constexpr std::uint32_t NO_PREY = 0xFFFFFFFFu;
 
-public:
-    float speed;
+    /**
+     * @brief Direction du requin vers le poisson le plus proche (cliché des proies en début de pas).
+     * @return La direction, ou std::nullopt pour errer (cap calculé par Motion::integrate).
+     */
+    template <typename Traits>
+    std::optional<sf::Vector2f> steer(const Population& sharks, std::size_t i, const PopulationSnapshot& prey,
+                                      const FishIndex& fish, const Traits& traits);
 
-private:
-    float m_reproCooldown;
-    int m_eatenSheep;
-    int m_level;
-};
\ No newline at end of file
+    /**
+     * @brief Poisson à portée de mâchoires (biteRange), sans le tuer.
+     * @details La mise à mort est appliquée par World lors de la fusion : deux requins
+     * qui visent le même poisson ne le mangent qu'une fois.
+     * @return L'indice du poisson, ou NO_PREY.
+     */
+    template <typename Traits>
+    std::uint32_t findPrey(const Population& sharks, std::size_t i, const PopulationSnapshot& prey, const FishIndex& fish,
+                           const Traits& traits);
+
+    /// Gain d'énergie d'un repas.
+    void eat(Population& sharks, std::size_t i, const Config::StageTable& stages);
+    bool canReproduce(const Population& sharks, std::size_t i, const Config::StageTable& stages);
+    void resetReproduction(Population& sharks, std::size_t i, const Config::StageTable& stages);
+}
@@ -0,0 +1,322 @@
+/**
+ * @file World.hpp
+ * @author Sasha Marie te Rehorst (sasha.marieterehorst@gmail.com)
+ * @author Gael Guinaliu (rodez.gael@gmail.com)
+ * @brief Déclaration de la classe World : un écosystème complet et autonome.
+ * @details Un World possède tout son état (populations, index spatiaux, compteurs,
+ * temps, générateur aléatoire) : plusieurs mondes peuvent tourner en même temps,
+ * un par thread, sans rien partager. Un monde peut aussi répartir sa propre mise à jour
+ * sur plusieurs threads (setThreads) : le résultat reste identique à l'exécution séquentielle.
+ * Les entités mortes laissent un trou dans les colonnes (alive = 0) : les colonnes ne sont
+ * compactées que lorsque les trous dépassent une fraction de la population. Chaque entité
+ * vivante a une poignée stable (EntityHandles), valable jusqu'à sa mort.
+ * Les espèces suivent la table de traits compilée (Config::STAGES), ou une table chargée
+ * (setStages) : chaque phase du pas choisit une fois l'instanciation de ses noyaux.
+ * @version 1.3
+ * @date 2026-01-11
+ */
+
+#pragma once
+
+#ifndef WORLD_HPP
+#define WORLD_HPP
+
+#include <SFML/System.hpp>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <random>
+#include <string>
+#include <vector>
+#include "../Core/Config.hpp"
+#include "../Core/ThreadPool.hpp"
+#include "EntityHandles.hpp"
+#include "Grass.hpp"
+#include "MotionKernels.hpp"
+#include "PlantField.hpp"
+#include "Population.hpp"
+#include "Sheep.hpp"
+#include "Snapshot.hpp"
+#include "SpatialGrid.hpp"
+#include "Stats.hpp"
+
+/**
+ * @enum EntityType
+ * @brief Types d'entités créables.
+ */
+enum class EntityType { Plant, Bacteria, Fish, Shark };
+
+/**
+ * @class World
+ * @brief Écosystème marin : Plante -> Bactérie -> Poisson -> Requin.
+ */
+class World {
+public:
+    // -------------------------------------------------------------------------
+    // CONSTRUCTEUR
+    // -------------------------------------------------------------------------
+
+    /**
+     * @brief Construit un monde vide (à peupler avec init()).
+     * @param seed Graine du générateur aléatoire propre à ce monde.
+     * @param verbose Affiche les évolutions sur std::clog.
+     */
+    explicit World(unsigned int seed = 1, bool verbose = false);
+
+    // Réserve de threads et index liés à l'instance : un monde ne se copie pas.
+    World(const World&) = delete;
+    World& operator=(const World&) = delete;
+
+    // -------------------------------------------------------------------------
+    // CONFIGURATION
+    // -------------------------------------------------------------------------
+
+    /**
+     * @brief Fixe la graine du générateur aléatoire (runs reproductibles).
+     */
+    void seed(unsigned int seed);
+
+    /**
+     * @brief Fixe les limites du monde (et réindexe les entités existantes).
+     */
+    void setBounds(float xMin, float xMax, float yMin, float yMax);
+
+    /**
+     * @brief (Ré)initialise le monde avec les populations de départ données.
+     */
+    void init(int plants = 60, int prey = 25, int sharks = 2);
+
+    /**
+     * @brief Active le journal des évolutions sur std::clog.
+     */
+    void setVerbose(bool verbose) { m_verbose = verbose; }
+
+    /**
+     * @brief Nombre de threads utilisés par update() (0 = tous les cœurs, 1 = séquentiel).
+     * @details N'influe que sur la vitesse : les tranches et leur fusion ne dépendent pas
+     * du nombre de threads, donc une même graine donne la même trajectoire.
+     */
+    void setThreads(unsigned int threads);
+
+    /**
+     * @brief Passes de relaxation des collisions par pas (1 par défaut).
+     * @details Plus de passes séparent mieux les foules denses, pour un coût proportionnel.
+     */
+    void setCollisionIterations(int iterations);
+
+    /**
+     * @brief Choisit la représentation des plantes (Grass individuelles par défaut).
+     * @details Vide les plantes existantes : à appeler avant init().
+     */
+    void setPlantModel(PlantModel model);
+
+    /**
+     * @brief Remplace les traits des espèces (expériences : voir Config::loadStages).
+     * @details Les agents existants gardent leur taille et leur vitesse jusqu'à leur prochain stade.
+     * Réglage d'exécution : ni sauvegardé, ni modifié par restore().
+     */
+    void setStages(const Config::StageTable& stages) { m_customStages = stages; }
+
+    /// Revient à la table compilée (Config::STAGES).
+    void resetStages() { m_customStages.reset(); }
+
+    /// Traits des espèces en vigueur.
+    const Config::StageTable& stages() const { return m_customStages ? *m_customStages : Config::STAGES; }
+
+    bool isInitialised() const { return m_initialised; }
+
+    // -------------------------------------------------------------------------
+    // SIMULATION
+    // -------------------------------------------------------------------------
+
+    /**
+     * @brief Avance la simulation d'un pas de @p dt secondes.
+     */
+    void update(float dt);
+
+    /**
+     * @brief Ajoute une entité en (x, y).
+     */
+    void spawn(EntityType type, float x, float y);
+
+    // -------------------------------------------------------------------------
+    // SAUVEGARDE
+    // -------------------------------------------------------------------------
+
+    /**
+     * @brief Recopie l'état persistant du monde dans @p out (voir Snapshot.hpp).
+     * @details Simple copie de colonnes, sans allocation quand @p out a déjà servi :
+     * l'encodage et l'écriture du fichier peuvent ensuite se faire sur un autre thread.
+     */
+    void capture(WorldState& out) const;
+
+    /**
+     * @brief Remplace tout l'état du monde par @p state (ses colonnes sont reprises, pas copiées).
+     * @details Limites, modèle de plantes et générateur viennent de la sauvegarde ; les index
+     * spatiaux sont reconstruits. Les réglages d'exécution (threads, collisions) sont conservés.
+     */
+    void restore(WorldState&& state);
+
+    /// Sauvegarde dans @p path. @return false en cas d'erreur d'écriture.
+    bool save(const std::string& path) const;
+
+    /// Charge @p path. @return false si le fichier est invalide (le monde n'est alors pas modifié).
+    bool load(const std::string& path);
+
+    // -------------------------------------------------------------------------
+    // ACCÈS EN LECTURE
+    // -------------------------------------------------------------------------
+
+    EcosystemStats getStats() const;
+    PlantModel plantModel() const { return m_plantModel; }
+    const PlantStore& getPlants() const { return m_plants; }         ///< Modèle Individual.
+    const PlantField& getPlantField() const { return m_plantField; } ///< Modèle Field.
+    /// Colonnes des proies, trous compris : tester Population::alive.
+    const Population& getPrey() const { return m_prey; }
+    const Population& getSharks() const { return m_sharks; }
+
+    // --- Poignées (références stables d'un pas à l'autre) ---
+    EntityHandle preyHandle(std::size_t i) const { return m_preyHandles.handleOf(i); }   ///< @p i : proie vivante.
+    EntityHandle sharkHandle(std::size_t i) const { return m_sharkHandles.handleOf(i); } ///< @p i : requin vivant.
+    /// Indice actuel de la proie, ou rien si elle est morte depuis.
+    std::optional<std::size_t> resolvePrey(EntityHandle h) const { return m_preyHandles.resolve(h); }
+    std::optional<std::size_t> resolveShark(EntityHandle h) const { return m_sharkHandles.resolve(h); }
+    sf::Vector2f getBoundsMin() const { return {m_xMin, m_yMin}; }
+    sf::Vector2f getBoundsMax() const { return {m_xMax, m_yMax}; }
+
+    // --- Changements du dernier pas (enregistrement de trajectoires) ---
+    std::uint64_t stepCount() const { return m_step; }  ///< Pas depuis init() / restore().
+    std::uint32_t epoch() const { return m_epoch; }     ///< Change à chaque init() / restore().
+    /// Change quand les proies changent d'emplacement (compactage, init, restore) : sinon,
+    /// un emplacement vivant d'un pas à l'autre désigne la même proie.
+    std::uint32_t preyLayout() const { return m_preyHandles.layout(); }
+    std::uint32_t sharkLayout() const { return m_sharkHandles.layout(); }
+    /// Proies mortes au dernier pas, croissantes, repérées par leur rang parmi les proies du pas
+    /// (trous exclus) : l'indice qu'elles auraient si les colonnes étaient compactées à chaque pas.
+    const std::vector<std::uint32_t>& removedPrey() const { return m_removedPrey; }
+    const std::vector<std::uint32_t>& removedSharks() const { return m_removedSharks; }
+    /// Requins nés au dernier pas de l'évolution d'un poisson : les derniers ajoutés (après les bébés).
+    std::size_t evolvedSharks() const { return m_frame.newSharks.size(); }
+
+private:
+    // -------------------------------------------------------------------------
+    // MÉTHODES INTERNES
+    // -------------------------------------------------------------------------
+
+    sf::Vector2f randomPos();
+    std::uint8_t randomWanderSeed() { return (std::uint8_t)(m_rng() % 100); }
+    void spawnPlant(sf::Vector2f p);
+    std::size_t spawnPrey(sf::Vector2f p, std::uint8_t wanderSeed);
+    void spawnShark(sf::Vector2f p, std::uint8_t wanderSeed);
+    void recountStages();
+
+    void rebuildPlantIndex();
+    std::optional<Sheep::Food> nearestFood(sf::Vector2f p, float range) const;
+    void rebuildFishIndex();
+    void syncFishIndex();
+    void updateSharks(float dt);
+    void updatePrey(float dt);
+    /// Noyaux des agents instanciés sur la source de traits : stades de Config::Builtin, ou Config::Custom.
+    template <typename Traits> void updateSharks(float dt, const Traits& traits);
+    template <typename... Stages> void updatePrey(float dt, const Stages&... stages);
+    /// Direction des proies de [begin, end) dont le stade appartient à @p traits.
+    template <typename Traits> void perceivePrey(std::size_t begin, std::size_t end, Sheep::Dangers& dangers,
+                                                 Motion::Steering& steering, const Traits& traits);
+    void applyKills();
+    void applyGrazing(std::vector<sf::Vector2f>& newSharks);
+    void reserveGrowth();
+    void pairFertile(Population& pop, float radius,
+                     bool (*canReproduce)(const Population&, std::size_t, const Config::StageTable&),
+                     void (*reset)(Population&, std::size_t, const Config::StageTable&),
+                     std::vector<sf::Vector2f>& babies, int& bornCounter);
+    void solveCollisions();
+    void reap(Population& pop, EntityHandles& handles, int& deadCounter, int* stageCount, std::vector<std::uint32_t>& removed);
+    void compact(Population& pop, EntityHandles& handles, FishIndex* index);
+    void adopt(Population& pop, EntityHandles& handles);
+
+    // -------------------------------------------------------------------------
+    // ÉTAT
+    // -------------------------------------------------------------------------
+
+    // --- Limites et temps ---
+    float m_xMin = 0.f, m_xMax = 1000.f;
+    float m_yMin = 0.f, m_yMax = 1000.f;
+    float m_simulationTime = 0.f;
+
+    // --- Entités ---
+    PlantModel m_plantModel = PlantModel::Individual;
+    PlantStore m_plants;      ///< Modèle Individual.
+    PlantField m_plantField;  ///< Modèle Field.
+    Population m_prey;      ///< Bactéries et Poissons
+    Population m_sharks;
+    EntityHandles m_preyHandles;  ///< Poignées des proies (et trous de m_prey).
+    EntityHandles m_sharkHandles;
+
+    // --- Compteurs ---
+    int m_deadPrey = 0, m_deadSharks = 0;
+    int m_bornPrey = 0, m_bornSharks = 0;
+
+    /**
+     * @brief Proies de m_prey par stade (indice = colonne level, 1 à 3), mortes du pas comprises.
+     * @details Tenu à jour aux naissances, évolutions et au constat des morts (reap) : getStats()
+     * ne parcourt plus les proies. Le stade 3 (poisson devenu requin) n'existe que jusqu'à reap.
+     */
+    int m_preyStages[4] = {0, 0, 0, 0};
+
+    std::uint64_t m_step = 0;
+    std::uint32_t m_epoch = 0;
+    std::vector<std::uint32_t> m_removedPrey;   ///< Mortes au dernier pas (rangs, voir removedPrey()).
+    std::vector<std::uint32_t> m_removedSharks;
+
+    // --- Index spatiaux ---
+    PlantIndex m_plantIndex;  ///< Plantes vivantes.
+    FishIndex m_fishIndex;    ///< Poissons chassables (niveau 2 uniquement).
+
+    // Broadphase des collisions (réutilisée d'un pas à l'autre pour éviter les allocations)
+    struct BodyRef {
+        Population* pop;
+        std::uint32_t i;
+    };
+    SpatialGrid m_collisionGrid;
+    std::vector<BodyRef> m_bodies;
+    int m_collisionIterations = 1;
+
+    // --- Mise à jour parallèle ---
+    // Tampons avant : ce que chaque espèce voit de l'autre pendant le pas.
+    PopulationSnapshot m_preyFront;
+    PopulationSnapshot m_sharksFront;
+
+    /**
+     * @struct ChunkEvents
+     * @brief Interactions différées d'une tranche d'agents, appliquées lors de la fusion.
+     */
+    struct ChunkEvents {
+        std::vector<std::pair<std::uint32_t, std::uint32_t>> kills; ///< (requin, poisson visé).
+        std::vector<std::pair<std::uint32_t, std::uint32_t>> grazes; ///< (proie, plante ou cellule du champ visée).
+    };
+    std::vector<ChunkEvents> m_sharkEvents; ///< Une entrée par tranche de requins.
+    std::vector<ChunkEvents> m_preyEvents;  ///< Une entrée par tranche de proies.
+    std::vector<std::uint32_t> m_fertile;   ///< Candidats à la reproduction (réutilisé).
+    SpatialGrid m_mateGrid;                 ///< Candidats rangés par cellule (indices dans m_fertile).
+
+    /**
+     * @struct FrameScratch
+     * @brief Tampons transitoires d'un pas, vidés au début du pas suivant (capacité conservée).
+     */
+    struct FrameScratch {
+        std::vector<sf::Vector2f> babyPrey;
+        std::vector<sf::Vector2f> babySharks;
+        std::vector<sf::Vector2f> newSharks;   ///< Poissons devenus requins.
+        void clear() { babyPrey.clear(); babySharks.clear(); newSharks.clear(); }
+    };
+    FrameScratch m_frame;
+    std::unique_ptr<ThreadPool> m_pool;     ///< nullptr = mise à jour sur le thread appelant.
+
+    // --- Divers ---
+    std::optional<Config::StageTable> m_customStages; ///< Table chargée, sinon Config::STAGES.
+    std::mt19937 m_rng;           ///< Générateur aléatoire propre au monde.
+    bool m_initialised = false;
+    bool m_verbose = false;
+};
+
+#endif
@@ -0,0 +1,75 @@
+/**
+ * @file Camera.hpp
+ * @author Sasha Marie te Rehorst (sasha.marieterehorst@gmail.com)
+ * @author Gael Guinaliu (rodez.gael@gmail.com)
+ * @brief Caméra de la zone de jeu : zoom et déplacement dans un monde plus grand que l'écran.
+ * @details La caméra tient une sf::View dont le viewport est la zone de jeu. Au zoom 1, le monde
+ * entier est visible (proportions conservées) ; au-delà, la vue reste dans le monde.
+ * Le Renderer ne rassemble que ce qui touche visibleArea().
+ * @version 1.0
+ * @date 2026-01-24
+ */
+
+#pragma once
+
+#ifndef CAMERA_HPP
+#define CAMERA_HPP
+
+#include <SFML/Graphics.hpp>
+
+/**
+ * @class Camera
+ * @brief Vue sur le monde pilotée à la souris (molette : zoom, glisser : déplacement).
+ */
+class Camera {
+public:
+    static constexpr float MAX_PIXELS_PER_UNIT = 8.f; ///< Zoom maximal : une unité du monde = 8 pixels.
+    static constexpr float WHEEL_STEP = 1.2f;         ///< Facteur de zoom par cran de molette.
+
+    /**
+     * @brief Zone de la fenêtre (pixels) où le monde est affiché.
+     */
+    void setArea(sf::FloatRect area, sf::Vector2u windowSize);
+
+    /**
+     * @brief Monde à montrer : s'il a changé (chargement, relecture), la caméra le cadre en entier.
+     */
+    void setWorld(sf::FloatRect world);
+
+    /**
+     * @brief Revient au monde entier.
+     */
+    void reset();
+
+    /**
+     * @brief Zoome de @p factor (> 1 : rapproche) en gardant fixe le point du monde sous @p pixel.
+     */
+    void zoomAt(sf::Vector2i pixel, float factor);
+
+    /**
+     * @brief Fait glisser le monde de @p delta pixels (le monde suit la souris).
+     */
+    void pan(sf::Vector2i delta);
+
+    bool contains(sf::Vector2i pixel) const { return m_area.contains(sf::Vector2f(pixel)); }
+
+    const sf::View& view() const { return m_view; }
+    sf::FloatRect visibleArea() const { return {m_view.getCenter() - m_view.getSize() * 0.5f, m_view.getSize()}; }
+    float pixelsPerUnit() const { return m_fitScale * m_zoom; }
+
+private:
+    /**
+     * @brief Borne le zoom et le centre, puis recalcule la vue.
+     */
+    void apply();
+
+    sf::FloatRect m_area{{0.f, 0.f}, {1.f, 1.f}};
+    sf::Vector2u m_windowSize{1, 1};
+    sf::FloatRect m_world{{0.f, 0.f}, {1.f, 1.f}};
+    float m_fitScale = 1.f;  ///< Pixels par unité du monde au zoom 1 (monde entier).
+    float m_zoom = 1.f;      ///< Grossissement par rapport au monde entier.
+    sf::Vector2f m_center{0.5f, 0.5f};
+    sf::View m_view;
+};
+
+#endif
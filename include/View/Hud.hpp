@@ -3,7 +3,9 @@
  * @author Sasha Marie te Rehorst
  * @author Gael Guinaliu
  * @brief Déclaration de la classe Hud avec support pour Agneaux et Louveteaux.
- * @version 1.0
+ * @details Les textes ne sont remis en page que lorsqu'une valeur affichée change ;
+ * l'historique des populations est tracé sous les statistiques (PopulationGraph).
+ * @version 1.1
  * @date 2026-01-07
  */
 
@@ -13,6 +15,12 @@
 #define HUD_HPP
 
 #include <SFML/Graphics.hpp>
+#include <array>
+#include <string>
+#include <vector>
+#include "../Core/Profiler.hpp"
+#include "../Model/Stats.hpp"
+#include "PopulationGraph.hpp"
 
 /**
  * @class Hud
@@ -33,12 +41,30 @@ public:
     bool init(sf::Vector2u windowSize);
 
     /**
-     * @brief Met à jour les textes affichés.
+     * @brief Met à jour les textes affichés (remis en page seulement si une valeur a changé).
      * @note Signature mise à jour pour inclure lambs et pups (10 arguments total).
      */
     void update(float fps, int grass, int sheep, int lambs, int wolves, int pups, 
                 int deadS, int deadW, int bornS, int bornW);
 
+    /**
+     * @brief Ajoute les effectifs à l'historique (échantillonné en temps simulé).
+     */
+    void record(const EcosystemStats& stats) { m_graph.record(stats); }
+
+    /**
+     * @brief Ligne d'état sous le FPS (relecture : vitesse, position, commandes). Vide = masquée.
+     */
+    void setStatus(const std::string& status);
+
+    /**
+     * @brief Met à jour la répartition du temps par phase.
+     * @details Les phases sont rapportées à la phase "image" (une boucle complète de
+     * l'Application) : temps moyen par image et part de l'image. Les tranches parallèles
+     * cumulent le temps de tous les threads.
+     */
+    void setProfile(const std::vector<Profiler::PhaseTiming>& phases);
+
     /**
      * @brief Dessine le HUD sur la fenêtre.
      * @param window Fenêtre de rendu.
@@ -64,7 +90,18 @@ private:
     sf::Text m_textFps;
     sf::Text m_textTitle;
     sf::Text m_textInfo;
+    sf::Text m_textProfile;
+    sf::Text m_textGraph;        ///< Légende de l'historique.
+    sf::Text m_textStatus;       ///< Ligne d'état (relecture).
+    std::string m_shownStatus;
+    PopulationGraph m_graph;
+    int m_shownFps = -1;         ///< FPS affiché (-1 : jamais).
+    std::array<int, 9> m_shownInfo; ///< Valeurs affichées dans m_textInfo.
+    bool m_hasInfo = false;
     float m_width;
+
+    /// Place l'historique en bas du panneau.
+    void layoutGraph(sf::Vector2u windowSize);
 };
 
 #endif
\ No newline at end of file
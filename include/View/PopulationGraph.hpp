@@ -0,0 +1,65 @@
+/**
+ * @file PopulationGraph.hpp
+ * @author Sasha Marie te Rehorst (sasha.marieterehorst@gmail.com)
+ * @author Gael Guinaliu (rodez.gael@gmail.com)
+ * @brief Courbes d'évolution des populations dans le HUD.
+ * @details Les effectifs sont échantillonnés à intervalle fixe de temps simulé dans un anneau
+ * de taille fixe (aucune allocation après la construction). Toutes les courbes sont dessinées
+ * en un seul appel : un tableau de segments, teintés par la couleur des sommets.
+ * @version 1.0
+ * @date 2026-01-19
+ */
+
+#pragma once
+
+#ifndef POPULATION_GRAPH_HPP
+#define POPULATION_GRAPH_HPP
+
+#include <SFML/Graphics.hpp>
+#include <array>
+#include <cstddef>
+#include "../Model/Stats.hpp"
+
+/**
+ * @class PopulationGraph
+ * @brief Historique glissant des effectifs et son tracé.
+ */
+class PopulationGraph {
+public:
+    static constexpr std::size_t CAPACITY = 240;    ///< Échantillons conservés.
+    static constexpr float SAMPLE_PERIOD = 0.5f;    ///< Temps simulé entre deux échantillons (s) : 2 minutes visibles.
+
+    PopulationGraph();
+
+    /**
+     * @brief Ajoute un échantillon si SAMPLE_PERIOD s'est écoulé depuis le précédent.
+     * @details Un temps simulé qui recule (remise à zéro, chargement) vide l'historique.
+     */
+    void record(const EcosystemStats& stats);
+
+    /// Vide l'historique.
+    void clear();
+
+    /// Zone du tracé dans la fenêtre.
+    void setArea(sf::FloatRect area) { m_area = area; m_dirty = true; }
+
+    void draw(sf::RenderWindow& window);
+
+private:
+    enum Series { PLANTS, BACTERIA, FISH, SHARKS, SERIES_COUNT };
+
+    /// Reconstruit les segments à partir de l'anneau (seulement après un nouvel échantillon).
+    void rebuild();
+
+    std::array<std::array<int, CAPACITY>, SERIES_COUNT> m_samples{};
+    std::size_t m_head = 0;   ///< Prochain emplacement écrit.
+    std::size_t m_count = 0;  ///< Échantillons valides (<= CAPACITY).
+    float m_lastSample = -1.f; ///< Temps simulé du dernier échantillon (< 0 : aucun).
+
+    sf::FloatRect m_area;
+    sf::RectangleShape m_frame;
+    sf::VertexArray m_lines;  ///< Segments de toutes les courbes (capacité conservée).
+    bool m_dirty = true;
+};
+
+#endif
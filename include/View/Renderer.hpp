@@ -4,16 +4,58 @@
  * @author Gael Guinaliu (rodez.gael@gmail.com)
  * @brief Déclaration de la classe Renderer : Gestion de l'affichage du monde.
  * @details Cette classe est responsable de l'affichage de la zone de simulation (le rectangle noir)
- * et de l'appel aux fonctions de dessin des entités.
+ * et du dessin des entités : l'apparence (forme, couleur) n'existe que dans la Vue.
+ * Toutes les entités sont dessinées en un seul lot : des quads texturés par un petit
+ * atlas de cercles, teintés par la couleur des sommets. Un champ d'algues (PlantField)
+ * est dessiné d'un bloc : une texture d'un pixel par cellule, mise à jour à chaque frame.
+ * Le contenu dessiné est décrit par une RenderScene : la dernière image publiée par le
+ * thread de simulation (RenderSnapshot), ou une image d'enregistrement relue (TrajectoryPlayer).
+ * Entre deux images de la simulation, les positions sont interpolées à la cadence du rendu. Une Camera choisit la région du monde affichée :
+ * seules les entités qui la touchent sont rassemblées, via les index spatiaux de la scène
+ * quand elle en fournit (le coût suit ce qui est à l'écran, pas la population du monde).
+ * En deçà d'un seuil de zoom, les sprites cèdent la place à une carte de densité par espèce
+ * (DensityGrid) : une texture de taille fixe, quel que soit le nombre d'agents.
  * Elle a été allégée pour ne plus gérer le texte (rôle transféré au Hud).
- * @version 0.5
- * @date 2026-01-05
+ * @version 0.7
+ * @date 2026-01-26
  */
 
 #pragma once
 
 // Inclusion de la bibliothèque graphique SFML
 #include <SFML/Graphics.hpp>
+#include <vector>
+#include "../Model/Grass.hpp"
+#include "../Model/PlantField.hpp"
+#include "../Model/Population.hpp"
+#include "../Model/RenderSnapshot.hpp"
+#include "Camera.hpp"
+
+/**
+ * @struct RenderScene
+ * @brief Ce qu'il faut dessiner : plantes et colonnes des deux espèces.
+ */
+struct RenderScene {
+    PlantModel plantModel = PlantModel::Individual;
+    const std::vector<Grass>* plants = nullptr;  ///< Emplacements (tester Grass::alive).
+    const PlantField* field = nullptr;
+    const Population* prey = nullptr;
+    const Population* sharks = nullptr;
+    /// Étendue du monde, cadrée par la caméra (vide : coordonnées du monde = de la zone de jeu).
+    sf::FloatRect bounds;
+
+    // Index facultatifs : sans eux, les colonnes sont parcourues en entier (relecture)
+    const RegionIndex* plantRegions = nullptr;
+    const RegionIndex* preyRegions = nullptr;
+    const RegionIndex* sharkRegions = nullptr;
+    const DensityGrid* density = nullptr; ///< Vue d'ensemble (sinon recomptée depuis les colonnes).
+    std::uint64_t frame = 0; ///< Identifiant du contenu (0 : inconnu) : sans density, recompte seulement s'il change.
+
+    // Interpolation facultative : position dessinée = from + (pos - from) * alpha
+    const std::vector<sf::Vector2f>* preyFrom = nullptr;
+    const std::vector<sf::Vector2f>* sharksFrom = nullptr;
+    float alpha = 1.f;
+};
 
 /**
  * @class Renderer
@@ -34,11 +76,33 @@ public:
     void init(sf::Vector2u windowSize, float hudWidth);
 
     /**
-     * @brief Dessine le fond et les entités.
-     * @details Affiche d'abord le rectangle noir, puis appelle ecosystemDraw() pour les animaux.
+     * @brief Dessine le fond et les entités d'une image du monde simulé.
+     * @details Affiche d'abord le rectangle noir, puis les plantes, proies et requins visibles.
      * @param window La fenêtre cible.
+     * @param alpha Avancement entre les positions de départ de l'image (0) et les siennes (1).
      */
-    void draw(sf::RenderWindow& window);
+    void draw(sf::RenderWindow& window, const RenderSnapshot& snapshot, float alpha);
+
+    /**
+     * @brief Dessine le fond puis la partie visible de @p scene (relecture d'un enregistrement).
+     * @details Un changement de scene.bounds recadre la caméra sur le monde entier.
+     */
+    void draw(sf::RenderWindow& window, const RenderScene& scene);
+
+    /// Caméra de la zone de jeu (commandée par l'Application).
+    Camera& camera() { return m_camera; }
+
+    /// Zoom par défaut sous lequel on passe aux densités (pixels par unité du monde).
+    static constexpr float DEFAULT_LOD_THRESHOLD = 0.5f;
+
+    /**
+     * @brief Zoom (pixels par unité du monde) sous lequel les densités remplacent les sprites.
+     * @details 0 : toujours des sprites.
+     */
+    void setLodThreshold(float pixelsPerUnit) { m_lodThreshold = pixelsPerUnit; }
+
+    /// Vue d'ensemble (densités) au zoom actuel ?
+    bool lodActive() const { return m_camera.pixelsPerUnit() < m_lodThreshold; }
 
     /**
      * @brief Recalcule la taille du rectangle noir lors du redimensionnement.
@@ -52,4 +116,59 @@ private:
     // La zone de jeu (Rectangle noir avec bordure grise)
     // C'est le "tapis" sur lequel les animaux se déplacent.
     sf::RectangleShape m_gameArea;
+    sf::RectangleShape m_worldArea; ///< Étendue du monde, dessinée dans la vue de la caméra.
+    Camera m_camera;
+
+    /// Marge autour de la région visible : un sprite centré juste dehors y déborde encore.
+    static constexpr float CULL_MARGIN = 32.f;
+
+    /**
+     * @enum Sprite
+     * @brief Cases de l'atlas (une par forme de base, teintée ensuite par sommet).
+     */
+    enum Sprite { SPRITE_DISC = 0, SPRITE_SHARK = 1, SPRITE_COUNT };
+
+    static constexpr unsigned ATLAS_CELL = 64; ///< Taille d'une case de l'atlas (px).
+
+    sf::Texture m_atlas;     ///< Atlas des cercles (disque blanc, disque cerclé de noir).
+    sf::VertexArray m_batch; ///< Lot de triangles reconstruit à chaque frame (capacité conservée).
+
+    sf::Texture m_fieldTexture;               ///< Champ d'algues, un pixel par cellule.
+    std::vector<std::uint8_t> m_fieldPixels;  ///< Pixels RGBA du champ (capacité conservée).
+
+    // --- Vue d'ensemble (LOD) ---
+    float m_lodThreshold = DEFAULT_LOD_THRESHOLD;
+    sf::Texture m_densityTexture;              ///< Une cellule de DensityGrid par pixel.
+    std::vector<std::uint8_t> m_densityPixels;
+    const DensityGrid* m_shownDensity = nullptr; ///< Grille et version recopiées dans la texture.
+    std::uint64_t m_shownVersion = 0;
+    DensityGrid m_sceneDensity;                ///< Pour une scène sans densités (relecture).
+    std::uint64_t m_sceneDensityFrame = 0;     ///< RenderScene::frame recompté dans m_sceneDensity.
+
+    /**
+     * @brief Génère l'atlas des cercles (anticrénelés) en mémoire.
+     */
+    void buildAtlas();
+
+    /**
+     * @brief Ajoute un quad (2 triangles) centré en @p center au lot.
+     * @param halfSize Demi-côté du quad (rayon du cercle, contour compris).
+     */
+    void appendSprite(sf::Vector2f center, float halfSize, sf::Color color, Sprite sprite);
+
+    /**
+     * @brief Recopie la biomasse des cellules visibles dans la texture du champ et les dessine.
+     * @param min,max Région visible (marge comprise).
+     */
+    void drawPlantField(sf::RenderWindow& window, const PlantField& field, sf::Vector2f min, sf::Vector2f max);
+
+    /**
+     * @brief Dessine la carte de densité de la scène (recopiée dans sa texture si elle a changé).
+     */
+    void drawDensity(sf::RenderWindow& window, const RenderScene& scene);
+
+    /**
+     * @brief Remplit le lot avec les entités de la région visible et le dessine en un appel.
+     */
+    void drawEcosystem(sf::RenderWindow& window, const RenderScene& scene);
 };
\ No newline at end of file
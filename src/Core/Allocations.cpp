@@ -0,0 +1,57 @@
+/**
+ * @file Allocations.cpp
+ * @author Sasha Marie te Rehorst (sasha.marieterehorst@gmail.com)
+ * @author Gael Guinaliu (rodez.gael@gmail.com)
+ * @brief Remplacement d'operator new / delete avec comptage.
+ * @details Les formes tableau, nothrow et dimensionnées se rabattent par défaut sur celles-ci ;
+ * seules les formes alignées doivent être remplacées à part. Lié au seul banc d'essai
+ * (voir CMakeLists.txt) : l'application et le mode sans affichage gardent l'allocateur standard.
+ * @version 1.0
+ * @date 2026-01-16
+ */
+
+// AUCUN INCLUDE ICI (Géré par CMake)
+#include <new> // std::bad_alloc, std::align_val_t (hors PCH : propre à ce fichier)
+#if defined(_WIN32)
+#include <malloc.h> // _aligned_malloc / _aligned_free
+#endif
+
+static std::atomic<std::uint64_t> g_allocations{0};
+
+std::uint64_t Allocations::count() { return g_allocations.load(std::memory_order_relaxed); }
+
+void* operator new(std::size_t size) {
+    g_allocations.fetch_add(1, std::memory_order_relaxed);
+    if (void* p = std::malloc(size ? size : 1)) return p;
+    throw std::bad_alloc();
+}
+
+// Formes alignées : l'API dépend de la plateforme (et _aligned_malloc exige _aligned_free)
+static void* alignedAlloc(std::size_t size, std::size_t align) {
+    align = std::max(sizeof(void*), align);
+#if defined(_WIN32)
+    return _aligned_malloc(size, align);
+#else
+    void* p = nullptr;
+    return posix_memalign(&p, align, size) == 0 ? p : nullptr;
+#endif
+}
+
+static void alignedFree(void* p) {
+#if defined(_WIN32)
+    _aligned_free(p);
+#else
+    std::free(p);
+#endif
+}
+
+void* operator new(std::size_t size, std::align_val_t align) {
+    g_allocations.fetch_add(1, std::memory_order_relaxed);
+    if (void* p = alignedAlloc(size ? size : 1, (std::size_t)align)) return p;
+    throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+void operator delete(void* p, std::align_val_t) noexcept { alignedFree(p); }
+void operator delete(void* p, std::size_t, std::align_val_t) noexcept { alignedFree(p); }
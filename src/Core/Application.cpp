@@ -7,7 +7,23 @@
 
 sf::Clock clockFps;
 
-Application::Application(bool testMode) : m_isTestMode(testMode), m_isPaused(false) {
+// Sauvegardes : automatique (arrière-plan, toutes les AUTOSAVE_PERIOD s réelles) et rapide (F5 / F9)
+static const char* AUTOSAVE_FILE = "autosave.spore2d";
+static const char* QUICKSAVE_FILE = "quicksave.spore2d";
+static constexpr double AUTOSAVE_PERIOD = 60.0;
+
+// Relecture : un enregistrement contient une image par pas (60 par seconde simulée)
+static constexpr double PLAYBACK_RATE = 60.0;
+static constexpr int PLAYBACK_JUMP = 300;       ///< Images sautées par [Gauche] / [Droite] (5 s).
+static constexpr int PLAYBACK_SKIM_SPEED = 100; ///< À partir de cette vitesse : images clés seulement.
+
+// Populations de départ de World::init, pour un monde de la taille de la zone de jeu
+static constexpr int START_PLANTS = 60;
+static constexpr int START_PREY = 25;
+static constexpr int START_SHARKS = 2;
+
+Application::Application(bool testMode, unsigned int seed)
+    : m_autosave(AUTOSAVE_FILE), m_simulation(defaultWorld()), m_isTestMode(testMode), m_isPaused(false) {
     sf::VideoMode desktopMode = sf::VideoMode::getDesktopMode();
     m_window.create(desktopMode, "Spore2D : Marine Evolution", sf::Style::Default);
     m_window.setFramerateLimit(60);
@@ -16,30 +32,239 @@ Application::Application(bool testMode) : m_isTestMode(testMode), m_isPaused(fal
     m_renderer.init(m_window.getSize(), m_hud.getWidth());
     
     // Définition des bordures
-    setWorldBounds(m_hud.getWidth() + 5.f, (float)m_window.getSize().x - 5.f, 5.f, (float)m_window.getSize().y - 15.f);
+    applyWorldBounds();
+
+    // Le rendu n'attend plus la simulation, mais chaque pas garde intérêt à utiliser tous les cœurs
+    setEcosystemThreads(0);
+
+    // Après chaque pas, sur le thread de simulation
+    m_autosaveAt = SimulationThread::now();
+    m_simulation.setStepHook([this](World& world) {
+        if (m_recorder.isOpen()) m_recorder.record(world);
+        // Capture seulement : l'écriture se fait en arrière-plan (ignorée si la précédente n'est pas finie).
+        // Temps réel : en accéléré, une copie du monde par minute simulée coûterait trop cher
+        double now = SimulationThread::now();
+        if (now - m_autosaveAt >= AUTOSAVE_PERIOD && m_autosave.submit(world)) m_autosaveAt = now;
+    });
+
+    // Populations de départ, placées dans les bordures de la zone de jeu
+    m_simulation.post([seed](World& world) { world.seed(seed); });
+    resetEcosystem();
+}
+
+sf::FloatRect Application::worldBounds() const {
+    if (m_worldSize.x > 0.f && m_worldSize.y > 0.f) return sf::FloatRect({0.f, 0.f}, m_worldSize);
+    sf::Vector2f min(m_hud.getWidth() + 5.f, 5.f);
+    sf::Vector2f max((float)m_window.getSize().x - 5.f, (float)m_window.getSize().y - 15.f);
+    return sf::FloatRect(min, max - min);
+}
+
+/// Donne au monde les bordures @p b.
+static void setBounds(World& world, sf::FloatRect b) {
+    world.setBounds(b.position.x, b.position.x + b.size.x, b.position.y, b.position.y + b.size.y);
+}
+
+void Application::applyWorldBounds() {
+    m_simulation.post([b = worldBounds()](World& world) { setBounds(world, b); });
+}
+
+void Application::setWorldSize(sf::Vector2f size) {
+    m_worldSize = size;
+    applyWorldBounds();
+    resetEcosystem();
+}
+
+void Application::resetEcosystem() {
+    int plants = START_PLANTS, prey = START_PREY, sharks = START_SHARKS;
+    if (m_worldSize.x > 0.f && m_worldSize.y > 0.f) {
+        float areaW = (float)m_window.getSize().x - m_hud.getWidth() - 10.f, areaH = (float)m_window.getSize().y - 20.f;
+        double scale = (double)m_worldSize.x * m_worldSize.y / std::max(1.0, (double)areaW * areaH);
+        plants = (int)(START_PLANTS * scale);
+        prey = (int)(START_PREY * scale);
+        sharks = std::max(1, (int)(START_SHARKS * scale));
+    }
+    m_simulation.post([=](World& world) { world.init(plants, prey, sharks); });
+}
+
+void Application::onCameraEvent(const sf::Event& event) {
+    Camera& camera = m_renderer.camera();
+    if (const auto* wheel = event.getIf<sf::Event::MouseWheelScrolled>()) {
+        if (camera.contains(wheel->position)) camera.zoomAt(wheel->position, std::pow(Camera::WHEEL_STEP, wheel->delta));
+    } else if (const auto* press = event.getIf<sf::Event::MouseButtonPressed>()) {
+        if (press->button == sf::Mouse::Button::Left && camera.contains(press->position)) m_dragFrom = press->position;
+    } else if (const auto* release = event.getIf<sf::Event::MouseButtonReleased>()) {
+        if (release->button == sf::Mouse::Button::Left) m_dragFrom.reset();
+    } else if (const auto* move = event.getIf<sf::Event::MouseMoved>()) {
+        if (m_dragFrom) { camera.pan(move->position - *m_dragFrom); m_dragFrom = move->position; }
+    } else if (const auto* key = event.getIf<sf::Event::KeyPressed>()) {
+        if (key->code == sf::Keyboard::Key::C) camera.reset();
+    }
+}
+
+/// Charge @p path dans @p world, recadré sur @p bounds.
+static bool loadWorld(World& world, const std::string& path, sf::FloatRect bounds) {
+    if (!world.load(path)) {
+        std::cerr << "Sauvegarde illisible : " << path << std::endl;
+        return false;
+    }
+    // Fenêtre éventuellement d'une autre taille que celle de la sauvegarde
+    setBounds(world, bounds);
+    std::cout << "Sauvegarde chargee : " << path << std::endl;
+    return true;
+}
+
+bool Application::load(const std::string& path) {
+    if (m_simulation.running()) {
+        m_simulation.post([path, b = worldBounds()](World& world) { loadWorld(world, path, b); });
+        return true;
+    }
+    return loadWorld(defaultWorld(), path, worldBounds());
+}
+
+bool Application::play(const std::string& path) {
+    auto player = std::make_unique<TrajectoryPlayer>();
+    if (!player->open(path)) {
+        std::cerr << "Enregistrement illisible : " << path << std::endl;
+        return false;
+    }
+    std::cout << "Relecture : " << path << " (" << player->frameCount() << " images)" << std::endl;
+    m_player = std::move(player);
+    m_playhead = 0.0;
+    return true;
+}
+
+bool Application::record(const std::string& path) {
+    if (!m_recorder.open(path)) {
+        std::cerr << "Impossible d'ecrire " << path << std::endl;
+        return false;
+    }
+    std::cout << "Enregistrement : " << path << std::endl;
+    return true;
+}
+
+void Application::onPlaybackKey(sf::Keyboard::Key key) {
+    double last = (double)(m_player->frameCount() - 1);
+    switch (key) {
+        case sf::Keyboard::Key::Num1:   m_playSpeed = 1; break;
+        case sf::Keyboard::Key::Num2:   m_playSpeed = 10; break;
+        case sf::Keyboard::Key::Num3:   m_playSpeed = PLAYBACK_SKIM_SPEED; break;
+        case sf::Keyboard::Key::Hyphen: m_playDirection = -m_playDirection; break;
+        case sf::Keyboard::Key::Left:   m_playhead = std::max(0.0, m_playhead - PLAYBACK_JUMP); break;
+        case sf::Keyboard::Key::Right:  m_playhead = std::min(last, m_playhead + PLAYBACK_JUMP); break;
+        case sf::Keyboard::Key::Home:   m_playhead = 0.0; break;
+        case sf::Keyboard::Key::End:    m_playhead = last; break;
+        default: break;
+    }
+}
+
+void Application::onSpeedKey(sf::Keyboard::Key key) {
+    switch (key) {
+        case sf::Keyboard::Key::Num1: m_speed = 1; break;
+        case sf::Keyboard::Key::Num2: m_speed = 10; break;
+        case sf::Keyboard::Key::Num3: m_speed = 100; break;
+        case sf::Keyboard::Key::Num4: m_speed = SimulationThread::MAX_SPEED; break;
+        default: return;
+    }
+    m_simulation.setSpeed(m_speed);
+    showSpeed();
+}
+
+void Application::showSpeed() {
+    std::ostringstream status;
+    status << "VITESSE " << (m_speed == SimulationThread::MAX_SPEED ? "max" : "x" + std::to_string(m_speed));
+    // Vitesse obtenue : plus basse que demandée quand les pas ne tiennent pas dans le budget
+    if (m_isPaused) status << " (pause)";
+    else status << std::fixed << std::setprecision(1) << " (x" << m_simulation.snapshot().timeWarp << ")";
+    status << "\n[1/2/3/4] x1 x10 x100 max";
+    m_hud.setStatus(status.str());
+}
+
+void Application::updatePlayback(float dt) {
+    PROFILE_SCOPE("relecture");
+    double last = (double)(m_player->frameCount() - 1);
+    if (!m_isPaused) m_playhead = std::clamp(m_playhead + m_playDirection * m_playSpeed * dt * PLAYBACK_RATE, 0.0, last);
+
+    // En défilement rapide, une image sur trente suffit : on s'arrête à l'image clé (un décodage)
+    bool exact = m_isPaused || m_playSpeed < PLAYBACK_SKIM_SPEED;
+    if (!m_player->seek((std::size_t)m_playhead, exact)) {
+        m_playhead = (double)m_player->position(); // Image corrompue : on reste sur la dernière valide
+        m_isPaused = true;
+    }
+
+    std::ostringstream status;
+    status << std::fixed << std::setprecision(1) << "LECTURE " << (m_isPaused ? "(pause)" : "")
+           << (m_playDirection < 0 ? " -x" : " x") << m_playSpeed << "  "
+           << m_player->position() + 1 << " / " << m_player->frameCount() << "\n"
+           << "[1/2/3] Vitesse [-] Sens [<-/->] 5 s";
+    m_hud.setStatus(status.str());
 }
 
 void Application::run() {
+    if (!m_player) m_simulation.start(); // Désormais, seul le thread de simulation touche au monde
+    float profileRefresh = 0.f;
     while (m_window.isOpen()) {
+        PROFILE_SCOPE("image");
         float dt = clockFps.restart().asSeconds();
         while (const auto event = m_window.pollEvent()) {
             if (event->is<sf::Event::Closed>()) m_window.close();
+            onCameraEvent(*event);
             if (const auto* k = event->getIf<sf::Event::KeyPressed>()) {
                 if (k->code == sf::Keyboard::Key::Escape) m_window.close();
                 if (k->code == sf::Keyboard::Key::P) m_isPaused = !m_isPaused;
-                if (k->code == sf::Keyboard::Key::R) initEcosystem();
+                if (m_player) { onPlaybackKey(k->code); continue; } // Le monde simulé n'est pas affiché
+                onSpeedKey(k->code);
+                if (k->code == sf::Keyboard::Key::R) resetEcosystem();
+                if (k->code == sf::Keyboard::Key::F5) {
+                    m_simulation.post([](World& world) {
+                        if (world.save(QUICKSAVE_FILE)) std::cout << "Sauvegarde ecrite : " << QUICKSAVE_FILE << std::endl;
+                    });
+                }
+                if (k->code == sf::Keyboard::Key::F9) load(QUICKSAVE_FILE);
+                if (k->code == sf::Keyboard::Key::T && Profiler::ENABLED) {
+                    if (Profiler::writeChromeTrace("trace.json")) std::cout << "Trace ecrite : trace.json" << std::endl;
+                }
             }
         }
 
-        if (!m_isPaused) ecosystemUpdate(dt);
+        if (m_player) {
+            updatePlayback(dt);
+        } else {
+            // Dernière image publiée (sans attendre) ; la suivante portera ce que le zoom demande
+            m_simulation.setPaused(m_isPaused);
+            m_simulation.setWantDensity(m_renderer.lodActive());
+            m_simulation.acquire();
+        }
 
-        EcosystemStats s = getEcosystemStats();
+        // O(1) : comptes tenus à jour par le monde, ou lus dans l'en-tête de l'image relue
+        EcosystemStats s = m_player ? m_player->stats() : m_simulation.snapshot().stats;
+        m_hud.record(s);
         m_hud.update(1.f/dt, s.plants, s.preyTotal, s.bacteria, s.fish, s.sharks, 
                      s.deadPrey, s.deadSharks, s.bornPrey, s.bornSharks);
 
+        // Répartition des phases sur la dernière seconde, rafraîchie deux fois par seconde (lisible)
+        profileRefresh += dt;
+        if (profileRefresh >= 0.5f) {
+            profileRefresh = 0.f;
+            m_hud.setProfile(Profiler::summary(1.0));
+            if (!m_player) showSpeed();
+        }
+
         m_window.clear(sf::Color(5, 15, 30));
-        m_renderer.draw(m_window);
+        if (m_player) {
+            RenderScene scene;
+            scene.plantModel = m_player->plantModel();
+            scene.plants = &m_player->plants();
+            scene.field = &m_player->field();
+            scene.prey = &m_player->prey();
+            scene.sharks = &m_player->sharks();
+            scene.bounds = sf::FloatRect(m_player->boundsMin(), m_player->boundsMax() - m_player->boundsMin());
+            scene.frame = m_player->position() + 1;
+            m_renderer.draw(m_window, scene);
+        } else {
+            m_renderer.draw(m_window, m_simulation.snapshot(), (float)m_simulation.interpolation());
+        }
         m_hud.draw(m_window);
         m_window.display();
     }
+    m_simulation.stop();
 }
\ No newline at end of file
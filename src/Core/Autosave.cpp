@@ -0,0 +1,52 @@
+/**
+ * @file Autosave.cpp
+ * @author Sasha Marie te Rehorst (sasha.marieterehorst@gmail.com)
+ * @author Gael Guinaliu (rodez.gael@gmail.com)
+ * @brief Thread de sauvegarde en arrière-plan.
+ * @version 1.0
+ * @date 2026-01-18
+ */
+
+// AUCUN INCLUDE ICI (Géré par CMake)
+
+Autosave::Autosave(std::string path) : m_path(std::move(path)), m_thread(&Autosave::loop, this) {}
+
+Autosave::~Autosave() {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stop = true;
+    }
+    m_wake.notify_one();
+    m_thread.join();
+}
+
+bool Autosave::submit(const World& world) {
+    if (busy()) return false;
+    // Le thread de sauvegarde attend : la capture lui appartient de nouveau jusqu'au signal
+    world.capture(m_state);
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_busy.store(true, std::memory_order_release);
+    }
+    m_wake.notify_one();
+    return true;
+}
+
+void Autosave::loop() {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while (true) {
+        m_wake.wait(lock, [&] { return m_stop || m_busy.load(std::memory_order_acquire); });
+        if (!m_busy.load(std::memory_order_acquire)) return; // Arrêt demandé, rien en attente
+
+        lock.unlock();
+        bool ok;
+        {
+            PROFILE_SCOPE("sauvegarde");
+            ok = saveSnapshot(m_path, m_state);
+        }
+        (ok ? m_written : m_failed).fetch_add(1, std::memory_order_relaxed);
+        if (!ok) std::cerr << "Sauvegarde impossible : " << m_path << std::endl;
+        lock.lock();
+        m_busy.store(false, std::memory_order_release);
+    }
+}
@@ -0,0 +1,356 @@
+/**
+ * @file Bench.cpp
+ * @author Sasha Marie te Rehorst (sasha.marieterehorst@gmail.com)
+ * @author Gael Guinaliu (rodez.gael@gmail.com)
+ * @brief Scénarios du banc d'essai, mesures et rapport JSON.
+ * @version 1.0
+ * @date 2026-01-14
+ */
+
+// AUCUN INCLUDE ICI (Géré par CMake), sauf l'API système de mesure mémoire.
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/resource.h>
+#endif
+
+// -------------------------------------------------------------------------
+// SCÉNARIOS
+// -------------------------------------------------------------------------
+
+/**
+ * @struct BenchLayout
+ * @brief Disposition de départ, exprimée par agent pour rester comparable à toutes les tailles.
+ */
+struct BenchLayout {
+    const char* name;
+    float areaPerAgent;    ///< Surface du monde par agent (px²).
+    float plantsPerAgent;  ///< Algues au départ par agent.
+    float sharkShare;      ///< Part des agents qui sont des requins.
+    float fishShare;       ///< Part des proies qui partent au stade Poisson.
+};
+
+static const BenchLayout LAYOUTS[] = {
+    {"dense",  256.f,  0.5f, 0.01f, 0.10f}, // Foule : collisions nombreuses
+    {"sparse", 2500.f, 0.5f, 0.01f, 0.10f}, // Agents épars : recherches longues, peu de contacts
+    {"sharks", 1000.f, 0.5f, 0.20f, 0.50f}, // Chasse : un agent sur cinq est un requin
+};
+
+static const BenchLayout* findLayout(const std::string& name) {
+    for (const BenchLayout& l : LAYOUTS) if (name == l.name) return &l;
+    return nullptr;
+}
+
+static std::string sizeLabel(int agents) {
+    if (agents >= 1000000 && agents % 1000000 == 0) return std::to_string(agents / 1000000) + "M";
+    if (agents >= 1000 && agents % 1000 == 0) return std::to_string(agents / 1000) + "k";
+    return std::to_string(agents);
+}
+
+// Pas mesurés par défaut : à peu près le même nombre d'agents-pas pour chaque taille.
+static long defaultSteps(int agents) {
+    return std::clamp(2000000L / std::max(1, agents), 5L, 600L);
+}
+
+// Chauffe par défaut : le temps que l'occupation des grilles se stabilise (environ 2000 pas
+// en petit), bornée par le même budget d'agents-pas pour ne pas écraser les grandes tailles.
+static long defaultWarmup(int agents) {
+    return std::clamp(20000000L / std::max(1, agents), 20L, 2500L);
+}
+
+/// Pic de mémoire résidente du processus (Ko), -1 si inconnu sur cette plateforme.
+static long peakRssKb() {
+#if defined(__APPLE__)
+    rusage usage{};
+    getrusage(RUSAGE_SELF, &usage);
+    return (long)(usage.ru_maxrss / 1024); // Octets sous macOS
+#elif defined(__unix__)
+    rusage usage{};
+    getrusage(RUSAGE_SELF, &usage);
+    return (long)usage.ru_maxrss;          // Ko sous Linux
+#else
+    return -1;
+#endif
+}
+
+/**
+ * @brief Crée et peuple le monde d'un scénario (hors chronométrage).
+ */
+static void populate(World& world, const BenchLayout& layout, int agents, unsigned int seed, float& width, float& height) {
+    // Monde au format 16/10, de surface proportionnelle au nombre d'agents
+    float area = layout.areaPerAgent * (float)agents;
+    width = std::sqrt(area * 1.6f);
+    height = area / width;
+    world.setBounds(0.f, width, 0.f, height);
+
+    int sharks = (int)std::lround(agents * layout.sharkShare);
+    int prey = agents - sharks;
+    int fish = (int)std::lround(prey * layout.fishShare);
+    world.init((int)std::lround(agents * layout.plantsPerAgent), prey - fish, sharks);
+
+    // Les poissons sont placés par un générateur à part : init() garde la même séquence
+    std::mt19937 rng(seed ^ 0x9E3779B9u);
+    std::uniform_real_distribution<float> rx(30.f, std::max(31.f, width - 30.f)), ry(30.f, std::max(31.f, height - 30.f));
+    for (int i = 0; i < fish; ++i) world.spawn(EntityType::Fish, rx(rng), ry(rng));
+}
+
+// -------------------------------------------------------------------------
+// MESURES
+// -------------------------------------------------------------------------
+
+/**
+ * @struct Summary
+ * @brief Moyenne, écart-type (échantillon), minimum et maximum d'une série de mesures.
+ */
+struct Summary {
+    double mean = 0.0, stddev = 0.0, min = 0.0, max = 0.0;
+};
+
+static Summary summarize(const std::vector<double>& values) {
+    Summary s;
+    if (values.empty()) return s;
+    s.min = *std::min_element(values.begin(), values.end());
+    s.max = *std::max_element(values.begin(), values.end());
+    for (double v : values) s.mean += v;
+    s.mean /= (double)values.size();
+    if (values.size() > 1) {
+        double sq = 0.0;
+        for (double v : values) sq += (v - s.mean) * (v - s.mean);
+        s.stddev = std::sqrt(sq / (double)(values.size() - 1));
+    }
+    return s;
+}
+
+/**
+ * @struct ScenarioResult
+ * @brief Mesures d'un scénario (toutes répétitions).
+ */
+struct ScenarioResult {
+    std::string name;
+    const BenchLayout* layout = nullptr;
+    int agents = 0;
+    float width = 0.f, height = 0.f;
+    long steps = 0, warmup = 0;
+    Summary nsPerAgentStep, stepsPerSecond, meanAgents;
+    Summary allocationsPerStep; ///< Allocations sur le tas pendant les pas mesurés (0 attendu).
+    std::uint64_t maxAllocations = 0; ///< Pire répétition (total sur les pas mesurés).
+    long peakRssKb = -1;
+};
+
+static ScenarioResult runScenario(const BenchOptions& options, const BenchLayout& layout, int agents) {
+    ScenarioResult result;
+    result.name = std::string(layout.name) + "-" + sizeLabel(agents);
+    result.layout = &layout;
+    result.agents = agents;
+    result.steps = options.steps > 0 ? options.steps : defaultSteps(agents);
+    result.warmup = options.warmup >= 0 ? options.warmup : defaultWarmup(agents);
+
+    std::vector<double> nsPerAgentStep, stepsPerSecond, meanAgents, allocationsPerStep;
+    for (int rep = 0; rep < options.repetitions; ++rep) {
+        // Monde neuf à chaque répétition : même graine, même travail, seul le bruit de mesure varie
+        World world(options.seed);
+        world.setThreads(options.threads);
+        world.setPlantModel(options.plantModel);
+        populate(world, layout, agents, options.seed, result.width, result.height);
+        for (long s = 0; s < result.warmup; ++s) world.update(1.f / 60.f);
+
+        double agentSteps = 0.0;
+        std::uint64_t allocations = Allocations::count();
+        sf::Clock clock;
+        for (long s = 0; s < result.steps; ++s) {
+            EcosystemStats stats = world.getStats(); // Vivants seulement (les colonnes gardent des trous)
+            agentSteps += (double)(stats.preyTotal + stats.sharks);
+            world.update(1.f / 60.f);
+        }
+        double ns = (double)clock.getElapsedTime().asMicroseconds() * 1000.0;
+        allocations = Allocations::count() - allocations;
+        result.maxAllocations = std::max(result.maxAllocations, allocations);
+        allocationsPerStep.push_back((double)allocations / (double)result.steps);
+
+        nsPerAgentStep.push_back(agentSteps > 0.0 ? ns / agentSteps : 0.0);
+        stepsPerSecond.push_back(ns > 0.0 ? result.steps * 1e9 / ns : 0.0);
+        meanAgents.push_back(agentSteps / (double)result.steps);
+    }
+
+    result.nsPerAgentStep = summarize(nsPerAgentStep);
+    result.stepsPerSecond = summarize(stepsPerSecond);
+    result.meanAgents = summarize(meanAgents);
+    result.allocationsPerStep = summarize(allocationsPerStep);
+    result.peakRssKb = peakRssKb();
+    return result;
+}
+
+// -------------------------------------------------------------------------
+// RAPPORT JSON
+// -------------------------------------------------------------------------
+
+static void writeSummary(std::ostream& out, const char* key, const Summary& s, bool last = false) {
+    out << "      \"" << key << "\": {\"mean\": " << s.mean << ", \"stddev\": " << s.stddev
+        << ", \"min\": " << s.min << ", \"max\": " << s.max << "}" << (last ? "\n" : ",\n");
+}
+
+static void writeJson(std::ostream& out, const BenchOptions& options, unsigned int threads,
+                      const std::vector<ScenarioResult>& results) {
+    out << std::setprecision(6);
+    out << "{\n"
+        << "  \"benchmark\": \"Spore2D_bench\",\n"
+        << "  \"seed\": " << options.seed << ",\n"
+        << "  \"repetitions\": " << options.repetitions << ",\n"
+        << "  \"threads\": " << threads << ",\n"
+        << "  \"hardware_threads\": " << std::thread::hardware_concurrency() << ",\n"
+        << "  \"isa\": \"" << Nearest::isaName(Nearest::activeIsa()) << "\",\n"
+        << "  \"plant_model\": \"" << plantModelName(options.plantModel) << "\",\n"
+        << "  \"bytes_per_agent\": " << Population::BYTES_PER_ENTITY << ",\n"
+        << "  \"scenarios\": [\n";
+    for (std::size_t k = 0; k < results.size(); ++k) {
+        const ScenarioResult& r = results[k];
+        out << "    {\n"
+            << "      \"name\": \"" << r.name << "\",\n"
+            << "      \"layout\": \"" << r.layout->name << "\",\n"
+            << "      \"agents\": " << r.agents << ",\n"
+            << "      \"world\": [" << r.width << ", " << r.height << "],\n"
+            << "      \"steps\": " << r.steps << ",\n"
+            << "      \"warmup_steps\": " << r.warmup << ",\n";
+        writeSummary(out, "ns_per_agent_step", r.nsPerAgentStep);
+        writeSummary(out, "steps_per_second", r.stepsPerSecond);
+        writeSummary(out, "mean_agents", r.meanAgents);
+        writeSummary(out, "allocations_per_step", r.allocationsPerStep);
+        out << "      \"peak_rss_kb\": ";
+        if (r.peakRssKb >= 0) out << r.peakRssKb; else out << "null";
+        out << "\n    }" << (k + 1 < results.size() ? ",\n" : "\n");
+    }
+    out << "  ]\n}\n";
+}
+
+// -------------------------------------------------------------------------
+// LIGNE DE COMMANDE
+// -------------------------------------------------------------------------
+
+void printBenchUsage(const char* program) {
+    std::cout << "Usage : " << program << " [options]\n"
+              << "  --sizes LISTE    Nombres d'agents, suffixes k/M acceptes (defaut 1k,10k,100k,1M)\n"
+              << "  --layouts LISTE  Dispositions parmi dense,sparse,sharks (defaut toutes)\n"
+              << "  --reps N         Repetitions par scenario (defaut 3)\n"
+              << "  --steps N        Pas mesures par repetition, 0 = selon la taille (defaut 0)\n"
+              << "  --warmup N       Pas de chauffe avant la mesure (defaut selon la taille)\n"
+              << "  --max-allocs N   Echoue si une repetition alloue plus de N fois pendant la mesure\n"
+              << "  --seed S         Graine aleatoire (defaut 42)\n"
+              << "  --threads T      Threads par monde, 0 = tous les coeurs (defaut 0)\n"
+              << "  --plant-model M  individual ou field (champ de biomasse) (defaut individual)\n"
+              << "  --json FICHIER   Ecrit le rapport dans un fichier au lieu de la sortie standard\n"
+              << "  --help           Affiche cette aide" << std::endl;
+}
+
+static std::vector<std::string> splitList(const std::string& value) {
+    std::vector<std::string> items;
+    std::string item;
+    std::istringstream in(value);
+    while (std::getline(in, item, ',')) if (!item.empty()) items.push_back(item);
+    return items;
+}
+
+static int parseSize(const std::string& text) {
+    std::size_t used = 0;
+    double n = std::stod(text, &used);
+    std::string suffix = text.substr(used);
+    if (suffix == "k" || suffix == "K") n *= 1e3;
+    else if (suffix == "m" || suffix == "M") n *= 1e6;
+    else if (!suffix.empty()) throw std::invalid_argument(text);
+    return (int)std::lround(n);
+}
+
+bool parseBenchArgs(int argc, char* argv[], BenchOptions& options) {
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--help" || arg == "-h") { options.showHelp = true; continue; }
+
+        if (i + 1 >= argc) {
+            std::cerr << "Option inconnue ou valeur manquante : " << arg << std::endl;
+            return false;
+        }
+        std::string value = argv[++i];
+
+        try {
+            if (arg == "--sizes") {
+                options.sizes.clear();
+                for (const std::string& s : splitList(value)) options.sizes.push_back(parseSize(s));
+            }
+            else if (arg == "--layouts") options.layouts = splitList(value);
+            else if (arg == "--reps")    options.repetitions = std::stoi(value);
+            else if (arg == "--steps")   options.steps = std::stol(value);
+            else if (arg == "--warmup")  options.warmup = std::stol(value);
+            else if (arg == "--max-allocs") options.maxAllocations = std::stol(value);
+            else if (arg == "--seed")    options.seed = (unsigned int)std::stoul(value);
+            else if (arg == "--threads") options.threads = (unsigned int)std::stoul(value);
+            else if (arg == "--plant-model") {
+                auto model = plantModelFromName(value);
+                if (!model) throw std::invalid_argument(value);
+                options.plantModel = *model;
+            }
+            else if (arg == "--json")    options.jsonPath = value;
+            else {
+                std::cerr << "Option inconnue : " << arg << std::endl;
+                return false;
+            }
+        } catch (const std::exception&) {
+            std::cerr << "Valeur invalide pour " << arg << " : " << value << std::endl;
+            return false;
+        }
+    }
+
+    for (const std::string& l : options.layouts) {
+        if (!findLayout(l)) {
+            std::cerr << "Disposition inconnue : " << l << std::endl;
+            return false;
+        }
+    }
+    bool sizesOk = !options.sizes.empty();
+    for (int s : options.sizes) sizesOk = sizesOk && s > 0;
+    if (!sizesOk || options.layouts.empty() || options.repetitions < 1 || options.steps < 0 || options.warmup < -1
+        || options.maxAllocations < -1) {
+        std::cerr << "Tailles, dispositions et repetitions doivent etre positives." << std::endl;
+        return false;
+    }
+    return true;
+}
+
+// -------------------------------------------------------------------------
+// EXÉCUTION
+// -------------------------------------------------------------------------
+
+int runBench(const BenchOptions& options) {
+    unsigned int threads = options.threads ? options.threads : std::max(1u, std::thread::hardware_concurrency());
+
+    // Tailles croissantes : le pic mémoire du processus reste attribuable au plus gros scénario passé
+    std::vector<int> sizes = options.sizes;
+    std::sort(sizes.begin(), sizes.end());
+
+    std::vector<ScenarioResult> results;
+    bool allocationsOk = true;
+    for (int agents : sizes) {
+        for (const std::string& name : options.layouts) {
+            results.push_back(runScenario(options, *findLayout(name), agents));
+            const ScenarioResult& r = results.back();
+            // Progression sur la sortie d'erreur : le JSON reste seul sur la sortie standard
+            std::cerr << r.name << " : " << r.nsPerAgentStep.mean << " ns/agent/pas (+/- " << r.nsPerAgentStep.stddev
+                      << "), " << r.stepsPerSecond.mean << " pas/s, " << r.allocationsPerStep.mean << " alloc/pas, pic "
+                      << r.peakRssKb << " Ko" << std::endl;
+            if (options.maxAllocations >= 0 && r.maxAllocations > (std::uint64_t)options.maxAllocations) {
+                std::cerr << r.name << " : " << r.maxAllocations << " allocations pendant la mesure (max "
+                          << options.maxAllocations << ")" << std::endl;
+                allocationsOk = false;
+            }
+        }
+    }
+
+    if (options.jsonPath.empty()) {
+        writeJson(std::cout, options, threads, results);
+        return allocationsOk ? 0 : 1;
+    }
+    std::ofstream file(options.jsonPath);
+    if (!file) {
+        std::cerr << "Impossible d'ouvrir " << options.jsonPath << std::endl;
+        return 1;
+    }
+    writeJson(file, options, threads, results);
+    return allocationsOk ? 0 : 1;
+}
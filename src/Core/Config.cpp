@@ -0,0 +1,108 @@
+/**
+ * @file Config.cpp
+ * @author Sasha Marie te Rehorst (sasha.marieterehorst@gmail.com)
+ * @author Gael Guinaliu (rodez.gael@gmail.com)
+ * @brief Lecture des tables de traits.
+ * @version 1.0
+ * @date 2026-01-27
+ */
+
+// AUCUN INCLUDE ICI (Géré par CMake)
+
+namespace {
+    /// Nom d'un stade dans les fichiers (indice = niveau, vide : pas de stade).
+    const char* const STAGE_NAMES[Config::STAGE_COUNT] = {"", "bacteria", "fish", "shark"};
+
+    /**
+     * @struct TraitField
+     * @brief Champ de StageTraits lisible dans un fichier (un seul des deux pointeurs est non nul).
+     */
+    struct TraitField {
+        const char* name;
+        float Config::StageTraits::* real;
+        int Config::StageTraits::* integer;
+        bool length = false; ///< Rayon ou portée (px) : limité à Config::MAX_LENGTH.
+    };
+
+    const TraitField TRAIT_FIELDS[] = {
+        {"radius", &Config::StageTraits::radius, nullptr, true},
+        {"speed", &Config::StageTraits::speed, nullptr},
+        {"birthEnergy", &Config::StageTraits::birthEnergy, nullptr},
+        {"birthCooldown", &Config::StageTraits::birthCooldown, nullptr},
+        {"maxEnergy", &Config::StageTraits::maxEnergy, nullptr},
+        {"energyLoss", &Config::StageTraits::energyLoss, nullptr},
+        {"wanderRate", &Config::StageTraits::wanderRate, nullptr},
+        {"foodRange", &Config::StageTraits::foodRange, nullptr, true},
+        {"fleeRange", &Config::StageTraits::fleeRange, nullptr, true},
+        {"fleeBoost", &Config::StageTraits::fleeBoost, nullptr},
+        {"biteRange", &Config::StageTraits::biteRange, nullptr, true},
+        {"mealEnergy", &Config::StageTraits::mealEnergy, nullptr},
+        {"mealsToEvolve", nullptr, &Config::StageTraits::mealsToEvolve},
+        {"breedEnergy", &Config::StageTraits::breedEnergy, nullptr},
+        {"breedCost", &Config::StageTraits::breedCost, nullptr},
+        {"breedCooldown", &Config::StageTraits::breedCooldown, nullptr},
+        {"mateRange", &Config::StageTraits::mateRange, nullptr, true},
+    };
+
+    std::string trim(const std::string& s) {
+        std::size_t a = s.find_first_not_of(" \t\r"), b = s.find_last_not_of(" \t\r");
+        return a == std::string::npos ? std::string() : s.substr(a, b - a + 1);
+    }
+}
+
+bool Config::loadStages(const std::string& path, StageTable& out) {
+    std::ifstream file(path);
+    if (!file) {
+        std::cerr << "Configuration illisible : " << path << std::endl;
+        return false;
+    }
+
+    StageTable table = STAGES;
+    std::string line;
+    for (int number = 1; std::getline(file, line); ++number) {
+        line = trim(line.substr(0, line.find('#')));
+        if (line.empty()) continue;
+
+        auto fail = [&](const char* reason) {
+            std::cerr << path << ":" << number << " : " << reason << " (" << line << ")" << std::endl;
+            return false;
+        };
+        std::size_t eq = line.find('='), dot = line.find('.');
+        if (eq == std::string::npos || dot == std::string::npos || dot > eq) return fail("attendu stade.trait = valeur");
+        std::string stage = trim(line.substr(0, dot)), trait = trim(line.substr(dot + 1, eq - dot - 1));
+        std::string value = trim(line.substr(eq + 1));
+
+        std::size_t level = 1;
+        while (level < STAGE_COUNT && stage != STAGE_NAMES[level]) ++level;
+        if (level == STAGE_COUNT) return fail("stade inconnu");
+        const TraitField* field = std::find_if(std::begin(TRAIT_FIELDS), std::end(TRAIT_FIELDS),
+                                               [&](const TraitField& f) { return trait == f.name; });
+        if (field == std::end(TRAIT_FIELDS)) return fail("trait inconnu");
+
+        try {
+            std::size_t used = 0;
+            if (field->real) {
+                float v = std::stof(value, &used);
+                if (!std::isfinite(v) || v < 0.f) return fail("valeur negative ou infinie");
+                if (field->length && v > MAX_LENGTH) return fail("longueur trop grande (max 1e6)");
+                table[level].*(field->real) = v;
+            } else {
+                int v = std::stoi(value, &used);
+                if (v < 0 || v > 255) return fail("valeur hors de [0, 255]");
+                table[level].*(field->integer) = v;
+            }
+            if (used != value.size()) return fail("valeur invalide");
+        } catch (const std::exception&) {
+            return fail("valeur invalide");
+        }
+    }
+    // Un agent sans rayon ne serait ni dessiné ni solide
+    for (std::size_t level = 1; level < STAGE_COUNT; ++level) {
+        if (table[level].radius <= 0.f) {
+            std::cerr << path << " : " << STAGE_NAMES[level] << ".radius doit etre positif" << std::endl;
+            return false;
+        }
+    }
+    out = table;
+    return true;
+}
@@ -0,0 +1,190 @@
+/**
+ * @file Headless.cpp
+ * @author Sasha Marie te Rehorst (sasha.marieterehorst@gmail.com)
+ * @author Gael Guinaliu (rodez.gael@gmail.com)
+ * @brief Boucle de simulation sans affichage et sortie CSV des statistiques.
+ * @version 1.0
+ * @date 2026-01-10
+ */
+
+// AUCUN INCLUDE ICI (Géré par CMake)
+
+// -------------------------------------------------------------------------
+// LIGNE DE COMMANDE
+// -------------------------------------------------------------------------
+
+void printHeadlessUsage(const char* program) {
+    std::cout << "Usage : " << program << " [options]\n"
+              << "  --width W      Largeur du monde (defaut 1600)\n"
+              << "  --height H     Hauteur du monde (defaut 1000)\n"
+              << "  --steps N      Nombre de pas (defaut 3600)\n"
+              << "  --dt S         Pas de temps fixe en secondes (defaut 1/60)\n"
+              << "  --seed S       Graine aleatoire (defaut 1)\n"
+              << "  --plants N     Algues au depart (defaut 60)\n"
+              << "  --prey N       Bacteries au depart (defaut 25)\n"
+              << "  --sharks N     Requins au depart (defaut 2)\n"
+              << "  --plant-model M  individual (algues une a une) ou field (champ de biomasse) (defaut individual)\n"
+              << "  --every N      Stats tous les N pas, 0 = fin seulement (defaut 60)\n"
+              << "  --csv FICHIER  Ecrit les stats dans un fichier au lieu de la sortie standard\n"
+              << "  --trace FICHIER  Ecrit la trace Chrome des phases (build avec SPORE2D_PROFILE)\n"
+              << "  --load FICHIER Reprend une sauvegarde (limites et populations) au lieu d'un monde neuf\n"
+              << "  --save FICHIER Sauvegarde le monde en fin de run (suffixe .K par run avec --runs)\n"
+              << "  --autosave N   Sauvegarde aussi tous les N pas, en arriere-plan (avec --save)\n"
+              << "  --record FICHIER  Enregistre les trajectoires pour la relecture (Spore2D --play) (suffixe .K avec --runs)\n"
+              << "  --check-record Relit l'enregistrement en fin de run : nombre d'images, stats finales, sauts\n"
+              << "  --species FICHIER  Traits des especes, lignes \"fish.speed = 95\" (defaut : table compilee)\n"
+              << "  --runs N       Nombre de mondes, graines seed..seed+N-1 (defaut 1)\n"
+              << "  --threads T    Threads pour --runs, 0 = tous les coeurs (defaut 0)\n"
+              << "  --world-threads T  Threads par monde (gros effectifs), 0 = tous les coeurs (defaut 1)\n"
+              << "  --collision-iterations N  Passes de relaxation des collisions par pas (defaut 1)\n"
+              << "  --help         Affiche cette aide" << std::endl;
+}
+
+bool parseHeadlessArgs(int argc, char* argv[], HeadlessOptions& options) {
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--help" || arg == "-h") { options.showHelp = true; continue; }
+        if (arg == "--check-record") { options.checkRecord = true; continue; }
+
+        if (i + 1 >= argc) {
+            std::cerr << "Option inconnue ou valeur manquante : " << arg << std::endl;
+            return false;
+        }
+        std::string value = argv[++i];
+
+        try {
+            if (arg == "--width")       options.width = std::stof(value);
+            else if (arg == "--height") options.height = std::stof(value);
+            else if (arg == "--steps")  options.steps = std::stol(value);
+            else if (arg == "--dt")     options.dt = std::stof(value);
+            else if (arg == "--seed")   options.seed = (unsigned int)std::stoul(value);
+            else if (arg == "--plants") options.plants = std::stoi(value);
+            else if (arg == "--prey")   options.prey = std::stoi(value);
+            else if (arg == "--sharks") options.sharks = std::stoi(value);
+            else if (arg == "--plant-model") {
+                auto model = plantModelFromName(value);
+                if (!model) throw std::invalid_argument(value);
+                options.plantModel = *model;
+            }
+            else if (arg == "--every")  options.every = std::stol(value);
+            else if (arg == "--csv")    options.csvPath = value;
+            else if (arg == "--trace")  options.tracePath = value;
+            else if (arg == "--load")   options.loadPath = value;
+            else if (arg == "--save")   options.savePath = value;
+            else if (arg == "--autosave") options.autosaveEvery = std::stol(value);
+            else if (arg == "--record") options.recordPath = value;
+            else if (arg == "--species") options.speciesPath = value;
+            else if (arg == "--runs")   options.runs = std::stoi(value);
+            else if (arg == "--threads") options.threads = (unsigned int)std::stoul(value);
+            else if (arg == "--world-threads") options.worldThreads = (unsigned int)std::stoul(value);
+            else if (arg == "--collision-iterations") options.collisionIterations = std::stoi(value);
+            else {
+                std::cerr << "Option inconnue : " << arg << std::endl;
+                return false;
+            }
+        } catch (const std::exception&) {
+            std::cerr << "Valeur invalide pour " << arg << " : " << value << std::endl;
+            return false;
+        }
+    }
+
+    if (options.width <= 0.f || options.height <= 0.f || options.dt <= 0.f || options.steps < 0 ||
+        options.plants < 0 || options.prey < 0 || options.sharks < 0 || options.every < 0 || options.runs < 1 ||
+        options.collisionIterations < 1 || options.autosaveEvery < 0) {
+        std::cerr << "Les tailles, le pas de temps et les effectifs doivent etre positifs." << std::endl;
+        return false;
+    }
+    if (options.autosaveEvery > 0 && options.savePath.empty()) {
+        std::cerr << "--autosave demande un fichier (--save)." << std::endl;
+        return false;
+    }
+    if (options.checkRecord && options.recordPath.empty()) {
+        std::cerr << "--check-record demande un fichier (--record)." << std::endl;
+        return false;
+    }
+    return true;
+}
+
+// -------------------------------------------------------------------------
+// SIMULATION
+// -------------------------------------------------------------------------
+
+static void writeStatsHeader(std::ostream& out) {
+    out << "run,seed,step,time,plants,prey,bacteria,fish,sharks,deadPrey,deadSharks,bornPrey,bornSharks\n";
+}
+
+static void writeStatsRow(std::ostream& out, int run, unsigned int seed, const StatsSample& sample) {
+    const EcosystemStats& s = sample.stats;
+    out << run << ',' << seed << ',' << sample.step << ',' << s.simulationTime << ',' << s.plants << ','
+        << s.preyTotal << ',' << s.bacteria << ',' << s.fish << ',' << s.sharks << ',' << s.deadPrey << ','
+        << s.deadSharks << ',' << s.bornPrey << ',' << s.bornSharks << '\n';
+}
+
+int runHeadless(const HeadlessOptions& options) {
+    std::ofstream file;
+    std::ostream* out = &std::cout;
+    if (!options.csvPath.empty()) {
+        file.open(options.csvPath);
+        if (!file) {
+            std::cerr << "Impossible d'ouvrir " << options.csvPath << std::endl;
+            return 1;
+        }
+        out = &file;
+    }
+
+    // Un monde par graine : seed, seed + 1, ...
+    std::vector<HeadlessOptions> runs(options.runs, options);
+    for (int k = 0; k < options.runs; ++k) {
+        runs[k].seed = options.seed + (unsigned int)k;
+        if (options.runs > 1 && !options.savePath.empty()) runs[k].savePath += "." + std::to_string(k);
+        if (options.runs > 1 && !options.recordPath.empty()) runs[k].recordPath += "." + std::to_string(k);
+    }
+
+    // Les lignes partent dès qu'elles existent : un long run se suit (et survit) au fil de l'eau
+    bool header = false;
+    auto writeRow = [&](int run, unsigned int seed, const StatsSample& sample) {
+        if (!header) { writeStatsHeader(*out); header = true; }
+        writeStatsRow(*out, run, seed, sample);
+    };
+
+    sf::Clock clock;
+    bool failed = false;
+    if (options.runs == 1) {
+        // Un seul monde : chaque échantillon est écrit dès qu'il est pris
+        SweepResult result = runWorld(runs[0], [&](const StatsSample& sample) {
+            writeRow(0, runs[0].seed, sample);
+            out->flush();
+        });
+        if (!result.error.empty()) { std::cerr << result.error << std::endl; failed = true; }
+    } else {
+        // Plusieurs mondes : chaque graine est écrite dès qu'elle et les précédentes sont finies (ordre du CSV inchangé)
+        std::vector<const SweepResult*> finished(runs.size(), nullptr);
+        std::size_t written = 0;
+        runSweep(runs, options.threads, [&](std::size_t k, const SweepResult& result) {
+            finished[k] = &result;
+            for (; written < finished.size() && finished[written] && !failed; ++written) {
+                const SweepResult& done = *finished[written];
+                if (!done.error.empty()) { std::cerr << done.error << std::endl; failed = true; break; }
+                for (const StatsSample& sample : done.samples) writeRow((int)written, done.options.seed, sample);
+                out->flush();
+            }
+        });
+    }
+    float elapsed = clock.getElapsedTime().asSeconds();
+    if (failed) return 1;
+
+    if (!options.tracePath.empty()) {
+        if (!Profiler::ENABLED) std::cerr << "Chronometrage non compile (SPORE2D_PROFILE) : trace vide." << std::endl;
+        if (!Profiler::writeChromeTrace(options.tracePath)) {
+            std::cerr << "Impossible d'ecrire " << options.tracePath << std::endl;
+            return 1;
+        }
+    }
+
+    // Résumé sur la sortie d'erreur pour ne pas polluer le CSV
+    double totalSteps = (double)options.steps * options.runs;
+    std::cerr << options.runs << " monde(s) x " << options.steps << " pas en " << elapsed << " s ("
+              << (elapsed > 0.f ? totalSteps / elapsed : 0.0) << " pas/s, "
+              << Population::BYTES_PER_ENTITY << " octets/agent)" << std::endl;
+    return 0;
+}
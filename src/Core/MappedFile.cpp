@@ -0,0 +1,59 @@
+/**
+ * @file MappedFile.cpp
+ * @author Sasha Marie te Rehorst (sasha.marieterehorst@gmail.com)
+ * @author Gael Guinaliu (rodez.gael@gmail.com)
+ * @brief Projection mmap (POSIX) ou lecture complète (ailleurs).
+ * @version 1.0
+ * @date 2026-01-20
+ */
+
+// AUCUN INCLUDE ICI (Géré par CMake)
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define MAPPED_FILE_HAS_MMAP
+#endif
+
+bool MappedFile::open(const std::string& path, bool sequential) {
+    close();
+#ifdef MAPPED_FILE_HAS_MMAP
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) return false;
+    struct stat info;
+    if (fstat(fd, &info) != 0 || info.st_size <= 0) { ::close(fd); return false; }
+    std::size_t size = (std::size_t)info.st_size;
+    void* map = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd); // La projection reste valide sans le descripteur
+    if (map == MAP_FAILED) return false;
+    madvise(map, size, sequential ? MADV_SEQUENTIAL : MADV_RANDOM);
+    m_map = map;
+    m_data = static_cast<const std::uint8_t*>(map);
+    m_size = size;
+    return true;
+#else
+    (void)sequential;
+    std::ifstream in(path, std::ios::binary | std::ios::ate);
+    if (!in) return false;
+    std::streamoff size = in.tellg();
+    if (size <= 0) return false;
+    m_buffer.resize((std::size_t)size);
+    in.seekg(0);
+    if (!in.read(reinterpret_cast<char*>(m_buffer.data()), size)) { m_buffer.clear(); return false; }
+    m_data = m_buffer.data();
+    m_size = m_buffer.size();
+    return true;
+#endif
+}
+
+void MappedFile::close() {
+#ifdef MAPPED_FILE_HAS_MMAP
+    if (m_map) munmap(m_map, m_size);
+#endif
+    m_map = nullptr;
+    m_buffer.clear();
+    m_buffer.shrink_to_fit();
+    m_data = nullptr;
+    m_size = 0;
+}
@@ -0,0 +1,151 @@
+/**
+ * @file Profiler.cpp
+ * @author Sasha Marie te Rehorst (sasha.marieterehorst@gmail.com)
+ * @author Gael Guinaliu (rodez.gael@gmail.com)
+ * @brief Anneaux par thread, résumé glissant et export trace_event.
+ * @version 1.0
+ * @date 2026-01-15
+ */
+
+// AUCUN INCLUDE ICI (Géré par CMake)
+
+std::int64_t Profiler::nowNs() {
+    static const auto origin = std::chrono::steady_clock::now();
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - origin).count();
+}
+
+#ifdef SPORE2D_PROFILE
+
+namespace {
+
+constexpr std::uint64_t RING_CAPACITY = 8192; ///< Intervalles conservés par thread.
+
+/**
+ * @struct Ring
+ * @brief Anneau d'un thread : un seul écrivain, lecteurs concurrents.
+ * @details Les champs sont atomiques (accès relâchés) : un lecteur peut croiser l'écrivain
+ * sans comportement indéfini, et vérifie après coup que l'entrée n'a pas été réécrite.
+ */
+struct Ring {
+    struct Slot {
+        std::atomic<const char*> name{nullptr};
+        std::atomic<std::int64_t> start{0};
+        std::atomic<std::int64_t> end{0};
+    };
+    Slot slots[RING_CAPACITY];
+    std::atomic<std::uint64_t> head{0}; ///< Nombre total d'intervalles écrits.
+    std::atomic<bool> inUse{false};     ///< Attribué à un thread vivant.
+    unsigned int id = 0;                ///< Numéro affiché dans la trace.
+};
+
+std::mutex g_ringsMutex;
+std::vector<std::unique_ptr<Ring>> g_rings; // Jamais libérés : un anneau libre est réattribué au prochain thread
+
+/**
+ * @brief Attribue un anneau au thread et le rend à sa sortie (les données restent lisibles).
+ */
+struct RingOwner {
+    Ring* ring = nullptr;
+    RingOwner() {
+        std::lock_guard<std::mutex> lock(g_ringsMutex);
+        for (auto& r : g_rings) {
+            bool expected = false;
+            if (r->inUse.compare_exchange_strong(expected, true)) { ring = r.get(); return; }
+        }
+        g_rings.push_back(std::make_unique<Ring>());
+        ring = g_rings.back().get();
+        ring->id = (unsigned int)g_rings.size();
+        ring->inUse = true;
+    }
+    ~RingOwner() { ring->inUse = false; }
+};
+
+Ring& threadRing() {
+    thread_local RingOwner owner; // Enregistrement (avec verrou) au premier intervalle du thread seulement
+    return *owner.ring;
+}
+
+/**
+ * @brief Appelle fn(ring, name, start, end) pour chaque intervalle valide de chaque anneau.
+ */
+template <typename Fn>
+void forEachInterval(Fn fn) {
+    std::vector<Ring*> rings;
+    {
+        std::lock_guard<std::mutex> lock(g_ringsMutex);
+        for (auto& r : g_rings) rings.push_back(r.get());
+    }
+    for (Ring* ring : rings) {
+        std::uint64_t head = ring->head.load(std::memory_order_acquire);
+        std::uint64_t begin = head > RING_CAPACITY ? head - RING_CAPACITY : 0;
+        struct Copy { const char* name; std::int64_t start, end; std::uint64_t k; };
+        std::vector<Copy> copies;
+        copies.reserve((std::size_t)(head - begin));
+        for (std::uint64_t k = begin; k < head; ++k) {
+            const Ring::Slot& s = ring->slots[k % RING_CAPACITY];
+            copies.push_back({s.name.load(std::memory_order_relaxed), s.start.load(std::memory_order_relaxed),
+                              s.end.load(std::memory_order_relaxed), k});
+        }
+        // Entrées réécrites (ou en cours de réécriture) pendant la copie : écartées
+        std::atomic_thread_fence(std::memory_order_acquire);
+        std::uint64_t now = ring->head.load(std::memory_order_relaxed);
+        std::uint64_t oldestSafe = now + 1 > RING_CAPACITY ? now + 1 - RING_CAPACITY : 0;
+        for (const Copy& c : copies)
+            if (c.k >= oldestSafe && c.name) fn(*ring, c.name, c.start, c.end);
+    }
+}
+
+} // namespace
+
+void Profiler::record(const char* name, std::int64_t startNs, std::int64_t endNs) {
+    Ring& ring = threadRing();
+    std::uint64_t k = ring.head.load(std::memory_order_relaxed);
+    Ring::Slot& s = ring.slots[k % RING_CAPACITY];
+    s.name.store(name, std::memory_order_relaxed);
+    s.start.store(startNs, std::memory_order_relaxed);
+    s.end.store(endNs, std::memory_order_relaxed);
+    ring.head.store(k + 1, std::memory_order_release);
+}
+
+std::vector<Profiler::PhaseTiming> Profiler::summary(double windowSeconds) {
+    std::int64_t from = nowNs() - (std::int64_t)(windowSeconds * 1e9);
+    std::vector<PhaseTiming> phases;
+    forEachInterval([&](const Ring&, const char* name, std::int64_t start, std::int64_t end) {
+        if (end < from) return;
+        auto it = std::find_if(phases.begin(), phases.end(), [&](const PhaseTiming& p) { return p.name == name; });
+        if (it == phases.end()) { phases.push_back({name, 0, 0.0, 0.0}); it = phases.end() - 1; }
+        it->calls++;
+        it->totalMs += (double)(end - start) * 1e-6;
+    });
+    for (PhaseTiming& p : phases) p.meanMs = p.totalMs / p.calls;
+    std::sort(phases.begin(), phases.end(), [](const PhaseTiming& a, const PhaseTiming& b) { return a.totalMs > b.totalMs; });
+    return phases;
+}
+
+void Profiler::writeChromeTrace(std::ostream& out) {
+    // Événements "X" (durée complète), horodatage et durée en microsecondes
+    out << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+    bool first = true;
+    out << std::fixed << std::setprecision(3);
+    forEachInterval([&](const Ring& ring, const char* name, std::int64_t start, std::int64_t end) {
+        out << (first ? "\n" : ",\n") << "{\"name\":\"" << name << "\",\"ph\":\"X\",\"pid\":1,\"tid\":" << ring.id
+            << ",\"ts\":" << (double)start * 1e-3 << ",\"dur\":" << (double)(end - start) * 1e-3 << "}";
+        first = false;
+    });
+    out << "\n]}\n";
+}
+
+#else
+
+void Profiler::record(const char*, std::int64_t, std::int64_t) {}
+std::vector<Profiler::PhaseTiming> Profiler::summary(double) { return {}; }
+void Profiler::writeChromeTrace(std::ostream& out) { out << "{\"traceEvents\":[]}\n"; }
+
+#endif
+
+bool Profiler::writeChromeTrace(const std::string& path) {
+    std::ofstream file(path);
+    if (!file) return false;
+    writeChromeTrace(file);
+    return (bool)file;
+}
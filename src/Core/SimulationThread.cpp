@@ -0,0 +1,130 @@
+/**
+ * @file SimulationThread.cpp
+ * @author Sasha Marie te Rehorst (sasha.marieterehorst@gmail.com)
+ * @author Gael Guinaliu (rodez.gael@gmail.com)
+ * @brief Boucle de simulation d'arrière-plan.
+ * @version 1.1
+ * @date 2026-01-26
+ */
+
+// AUCUN INCLUDE ICI (Géré par CMake)
+
+SimulationThread::SimulationThread(World& world) : m_world(world) {}
+
+SimulationThread::~SimulationThread() { stop(); }
+
+double SimulationThread::now() {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+void SimulationThread::start() {
+    if (running()) return;
+    publish(0); // Le rendu a une image dès sa première frame
+    m_stop = false;
+    m_thread = std::thread(&SimulationThread::loop, this);
+}
+
+void SimulationThread::stop() {
+    if (!running()) return;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stop = true;
+    }
+    m_wake.notify_one();
+    m_thread.join();
+    runCommands(); // Envoyées pendant l'arrêt : exécutées quand même (ex : sauvegarde)
+}
+
+void SimulationThread::post(Command command) {
+    if (!running()) { command(m_world); return; }
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_commands.push_back(std::move(command));
+    }
+    m_wake.notify_one();
+}
+
+bool SimulationThread::runCommands() {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_commands.empty()) return false;
+        m_running.swap(m_commands);
+    }
+    // Hors du verrou : une commande peut être longue (chargement) sans bloquer post()
+    for (Command& command : m_running) command(m_world);
+    m_running.clear();
+    return true;
+}
+
+void SimulationThread::publish(int steps) {
+    bool density = m_wantDensity.load(std::memory_order_relaxed);
+    const RenderSnapshot* previous = m_snapshots.hasPublished() ? &m_snapshots.lastPublished() : nullptr;
+    RenderSnapshot& snapshot = m_snapshots.back();
+    snapshot.capture(m_world, previous, density, now());
+    // Vitesse effective lissée : le nombre de pas par tour varie d'un tour à l'autre
+    if (snapshot.interval > 0.0) m_timeWarp = 0.9 * m_timeWarp + 0.1 * (steps * FIXED_DT / snapshot.interval);
+    snapshot.timeWarp = (float)m_timeWarp;
+    m_snapshots.publish();
+    m_publishedDensity = density;
+}
+
+double SimulationThread::interpolation() const {
+    const RenderSnapshot& s = snapshot();
+    if (s.interval <= 0.0) return 1.0;
+    return std::clamp((now() - s.publishedAt) / s.interval, 0.0, 1.0);
+}
+
+int SimulationThread::advance(double elapsed) {
+    int speed = m_speed.load(std::memory_order_relaxed);
+    bool unlimited = speed == MAX_SPEED;
+    if (!unlimited) m_accumulator += elapsed * speed;
+
+    double start = now();
+    int steps = 0;
+    while (unlimited || m_accumulator >= FIXED_DT) {
+        // Le pas suivant tiendrait-il encore dans le budget ? (le premier passe toujours : le monde avance)
+        double spent = now() - start;
+        if (steps > 0 && spent + m_stepCost > STEP_BUDGET) {
+            // Retard abandonné : la vitesse effective baisse au lieu de creuser l'écart
+            m_accumulator = std::min(m_accumulator, (double)FIXED_DT);
+            break;
+        }
+        double stepStart = now();
+        m_world.update(FIXED_DT);
+        if (m_stepHook) m_stepHook(m_world);
+        double cost = now() - stepStart;
+        m_stepCost = m_stepCost > 0.0 ? 0.9 * m_stepCost + 0.1 * cost : cost;
+        if (!unlimited) m_accumulator -= FIXED_DT;
+        steps++;
+    }
+    return steps;
+}
+
+void SimulationThread::loop() {
+    using Clock = std::chrono::steady_clock;
+    const auto period = std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(PUBLISH_PERIOD));
+    Clock::time_point nextTick = Clock::now();
+    double lastTick = now();
+    int unpublished = 0; // Pas calculés depuis la dernière image
+
+    while (true) {
+        bool changed = runCommands();
+
+        double t = now();
+        if (!m_paused.load(std::memory_order_relaxed)) unpublished += advance(t - lastTick);
+        else m_accumulator = 0.0; // En pause, le temps ne s'accumule pas
+        lastTick = t;
+
+        // Une image par tour qui a avancé le monde, ou quand le rendu change de niveau de détail
+        if (changed || unpublished > 0 || m_publishedDensity != m_wantDensity.load(std::memory_order_relaxed)) {
+            publish(unpublished);
+            unpublished = 0;
+        }
+
+        // Cadence : attente jusqu'au prochain tour, écourtée par une commande ou l'arrêt
+        nextTick = std::max(nextTick + period, Clock::now());
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_wake.wait_until(lock, nextTick, [&] { return m_stop || !m_commands.empty(); });
+        if (m_stop) break;
+    }
+}
@@ -0,0 +1,148 @@
+/**
+ * @file Sweep.cpp
+ * @author Sasha Marie te Rehorst (sasha.marieterehorst@gmail.com)
+ * @author Gael Guinaliu (rodez.gael@gmail.com)
+ * @brief Exécution parallèle de mondes indépendants.
+ * @version 1.0
+ * @date 2026-01-11
+ */
+
+// AUCUN INCLUDE ICI (Géré par CMake)
+
+static bool sameStats(const EcosystemStats& a, const EcosystemStats& b) {
+    return a.plants == b.plants && a.preyTotal == b.preyTotal && a.bacteria == b.bacteria && a.fish == b.fish
+        && a.sharks == b.sharks && a.deadPrey == b.deadPrey && a.deadSharks == b.deadSharks
+        && a.bornPrey == b.bornPrey && a.bornSharks == b.bornSharks && a.simulationTime == b.simulationTime;
+}
+
+/**
+ * @brief Relit un enregistrement qui vient d'être écrit (--check-record).
+ * @details Vérifie le nombre d'images, les stats de la dernière image contre celles du monde,
+ * puis un aller-retour : une image du milieu atteinte en avançant image par image doit être
+ * identique à la même image atteinte par un saut en arrière (décodée depuis son image clé).
+ * @return Le problème rencontré (vide = enregistrement conforme).
+ */
+static std::string checkRecording(const std::string& path, std::size_t frames, const EcosystemStats& last) {
+    TrajectoryPlayer player;
+    if (!player.open(path)) return "Enregistrement illisible : " + path;
+    if (player.frameCount() != frames)
+        return path + " : " + std::to_string(player.frameCount()) + " images au lieu de " + std::to_string(frames);
+
+    // En avançant jusqu'au milieu (une image delta si possible)
+    std::size_t middle = frames / 2;
+    if (middle % Trajectory::KEYFRAME_INTERVAL == 0 && middle > 0) middle--;
+    for (std::size_t f = 1; f <= middle; ++f) {
+        if (!player.seek(f)) return path + " : image " + std::to_string(f) + " corrompue";
+    }
+    EcosystemStats middleStats = player.stats();
+    std::vector<float> preyX = player.prey().x, preyY = player.prey().y;
+    std::vector<float> sharkX = player.sharks().x, sharkY = player.sharks().y;
+
+    if (!player.seek(frames - 1)) return path + " : image corrompue avant la fin";
+    if (!sameStats(player.stats(), last)) return path + " : stats de la derniere image differentes du monde";
+
+    // Saut en arrière : même image qu'en avançant
+    if (!player.seek(middle) || player.position() != middle) return path + " : saut en arriere impossible";
+    if (!sameStats(player.stats(), middleStats) || player.prey().x != preyX || player.prey().y != preyY
+        || player.sharks().x != sharkX || player.sharks().y != sharkY)
+        return path + " : image " + std::to_string(middle) + " differente apres un saut en arriere";
+    return {};
+}
+
+SweepResult runWorld(const HeadlessOptions& options, const std::function<void(const StatsSample&)>& onSample) {
+    SweepResult result;
+    result.options = options;
+    auto sample = [&](long step, const World& world) {
+        if (onSample) onSample({step, world.getStats()});
+        else result.samples.push_back({step, world.getStats()});
+    };
+
+    // Même ordre que l'Application : bordures, puis peuplement
+    World world(options.seed);
+    world.setThreads(options.worldThreads);
+    world.setCollisionIterations(options.collisionIterations);
+    world.setPlantModel(options.plantModel);
+    if (!options.speciesPath.empty()) {
+        Config::StageTable stages;
+        if (!Config::loadStages(options.speciesPath, stages)) {
+            result.error = "Configuration illisible : " + options.speciesPath;
+            return result;
+        }
+        world.setStages(stages);
+    }
+    world.setBounds(0.f, options.width, 0.f, options.height);
+    if (options.loadPath.empty()) {
+        world.init(options.plants, options.prey, options.sharks);
+    } else if (!world.load(options.loadPath)) {
+        // Limites, plantes et populations viennent de la sauvegarde
+        result.error = "Sauvegarde illisible : " + options.loadPath;
+        return result;
+    }
+
+    sample(0, world);
+
+    // Sauvegarde périodique : seule la capture est faite sur ce thread
+    std::optional<Autosave> autosave;
+    if (options.autosaveEvery > 0) autosave.emplace(options.savePath);
+
+    // Enregistrement : l'état de départ, puis une image par pas
+    TrajectoryRecorder recorder;
+    if (!options.recordPath.empty()) {
+        if (!recorder.open(options.recordPath)) {
+            result.error = "Impossible d'ecrire " + options.recordPath;
+            return result;
+        }
+        recorder.record(world);
+    }
+
+    sf::Clock clock;
+    for (long step = 1; step <= options.steps; ++step) {
+        world.update(options.dt);
+        if (options.every > 0 && step % options.every == 0) sample(step, world);
+        if (autosave && step % options.autosaveEvery == 0) autosave->submit(world);
+        if (recorder.isOpen()) recorder.record(world);
+    }
+    result.wallSeconds = clock.getElapsedTime().asSeconds();
+    recorder.close();
+    if (options.checkRecord && !options.recordPath.empty()) {
+        // L'état de départ, puis une image par pas
+        result.error = checkRecording(options.recordPath, (std::size_t)options.steps + 1, world.getStats());
+        if (!result.error.empty()) return result;
+    }
+
+    // La sauvegarde finale passe après l'éventuelle écriture en arrière-plan (même fichier)
+    autosave.reset();
+    if (!options.savePath.empty() && !world.save(options.savePath))
+        result.error = "Impossible d'ecrire " + options.savePath;
+
+    // Dernier échantillon si l'intervalle ne tombe pas pile sur la fin
+    if (options.steps > 0 && (options.every == 0 || options.steps % options.every != 0))
+        sample(options.steps, world);
+    return result;
+}
+
+std::vector<SweepResult> runSweep(const std::vector<HeadlessOptions>& runs, unsigned int threads,
+                                  const std::function<void(std::size_t, const SweepResult&)>& onFinished) {
+    std::vector<SweepResult> results(runs.size());
+    if (threads == 0) threads = std::max(1u, std::thread::hardware_concurrency());
+    threads = (unsigned int)std::min<std::size_t>(threads, runs.size());
+
+    // Chaque thread prend le prochain run libre : équilibrage simple quand les runs n'ont pas la même durée.
+    std::atomic<std::size_t> next{0};
+    std::mutex finishedMutex;
+    auto worker = [&]() {
+        for (std::size_t k = next++; k < runs.size(); k = next++) {
+            results[k] = runWorld(runs[k]);
+            if (onFinished) {
+                std::lock_guard<std::mutex> lock(finishedMutex);
+                onFinished(k, results[k]);
+            }
+        }
+    };
+
+    std::vector<std::thread> pool;
+    for (unsigned int t = 1; t < threads; ++t) pool.emplace_back(worker);
+    worker(); // Le thread appelant travaille aussi
+    for (auto& th : pool) th.join();
+    return results;
+}
@@ -0,0 +1,78 @@
+/**
+ * @file ThreadPool.cpp
+ * @author Sasha Marie te Rehorst (sasha.marieterehorst@gmail.com)
+ * @author Gael Guinaliu (rodez.gael@gmail.com)
+ * @brief Implémentation de la réserve de threads.
+ * @version 1.0
+ * @date 2026-01-12
+ */
+
+// AUCUN INCLUDE ICI (Géré par CMake)
+
+ThreadPool::ThreadPool(unsigned int threads) {
+    if (threads == 0) threads = std::max(1u, std::thread::hardware_concurrency());
+    for (unsigned int t = 1; t < threads; ++t) m_workers.emplace_back([this]() { workerLoop(); });
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stop = true;
+    }
+    m_wake.notify_all();
+    for (auto& th : m_workers) th.join();
+}
+
+void ThreadPool::drain(const Job& job, std::size_t chunks) {
+    for (std::size_t c = m_next++; c < chunks; c = m_next++) job(c);
+}
+
+void ThreadPool::run(std::size_t chunks, const Job& job) {
+    // Une seule tranche ou aucun thread : pas besoin de réveiller qui que ce soit
+    if (m_workers.empty() || chunks == 1) {
+        for (std::size_t c = 0; c < chunks; ++c) job(c);
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_job = &job;
+        m_chunks = chunks;
+        m_next = 0;
+        m_generation++;
+    }
+    m_wake.notify_all();
+
+    drain(job, chunks); // Le thread appelant travaille aussi
+
+    // On ne rend la main que quand plus aucun thread ne touche au travail (il vit sur notre pile)
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_idle.wait(lock, [this]() { return m_active == 0; });
+    m_job = nullptr;
+}
+
+void ThreadPool::workerLoop() {
+    std::size_t seen = 0;
+    for (;;) {
+        const Job* job;
+        std::size_t chunks;
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_wake.wait(lock, [&]() { return m_stop || m_generation != seen; });
+            if (m_stop) return;
+            seen = m_generation;
+            if (!m_job) continue; // Travail déjà terminé avant notre réveil
+            job = m_job;
+            chunks = m_chunks;
+            m_active++;
+        }
+
+        drain(*job, chunks);
+
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_active--;
+        }
+        m_idle.notify_one();
+    }
+}
@@ -0,0 +1,59 @@
+/**
+ * @file DensityGrid.cpp
+ * @author Sasha Marie te Rehorst (sasha.marieterehorst@gmail.com)
+ * @author Gael Guinaliu (rodez.gael@gmail.com)
+ * @brief Comptage des densités par espèce.
+ * @version 1.0
+ * @date 2026-01-25
+ */
+
+// AUCUN INCLUDE ICI (Géré par CMake)
+
+void DensityGrid::reset(float xMin, float xMax, float yMin, float yMax) {
+    float width = std::max(1.f, xMax - xMin), height = std::max(1.f, yMax - yMin);
+    m_cellSize = std::max(MIN_CELL_SIZE, std::max(width, height) / RESOLUTION);
+    m_invCell = 1.f / m_cellSize;
+    m_xMin = xMin; m_xMax = xMax;
+    m_yMin = yMin; m_yMax = yMax;
+    m_cols = std::max(1, (int)std::ceil(width * m_invCell));
+    m_rows = std::max(1, (int)std::ceil(height * m_invCell));
+    for (auto& layer : m_layers) layer.assign((std::size_t)m_cols * m_rows, 0u);
+    m_peaks.fill(0u);
+    m_version++;
+}
+
+void DensityGrid::bin(PlantModel model, const std::vector<Grass>& plants, const PlantField& field,
+                      const Population& prey, const Population& sharks) {
+    for (auto& layer : m_layers) std::fill(layer.begin(), layer.end(), 0u);
+
+    // Plantes : une par Grass vivante, ou la biomasse des cellules du champ
+    std::vector<std::uint32_t>& green = m_layers[PLANTS];
+    if (model == PlantModel::Field) {
+        const std::vector<std::uint8_t>& cells = field.cells();
+        sf::Vector2f origin = field.origin();
+        float size = field.cellSize();
+        for (int r = 0; r < field.rows(); ++r) {
+            float y = origin.y + (r + 0.5f) * size;
+            const std::uint8_t* row = &cells[(std::size_t)r * field.cols()];
+            for (int c = 0; c < field.cols(); ++c)
+                if (row[c]) green[cellOf(origin.x + (c + 0.5f) * size, y)] += row[c];
+        }
+    } else {
+        for (const Grass& p : plants) if (p.alive) green[cellOf(p.pos.x, p.pos.y)]++;
+    }
+
+    // Proies : la couche dépend du stade (les trous ont alive = 0)
+    std::vector<std::uint32_t>& bacteria = m_layers[BACTERIA];
+    std::vector<std::uint32_t>& fish = m_layers[FISH];
+    for (std::size_t i = 0; i < prey.size(); ++i) {
+        if (!prey.alive[i]) continue;
+        (prey.level[i] >= 2 ? fish : bacteria)[cellOf(prey.x[i], prey.y[i])]++;
+    }
+    std::vector<std::uint32_t>& sharkCounts = m_layers[SHARKS];
+    for (std::size_t i = 0; i < sharks.size(); ++i)
+        if (sharks.alive[i]) sharkCounts[cellOf(sharks.x[i], sharks.y[i])]++;
+
+    for (int l = 0; l < LAYER_COUNT; ++l)
+        m_peaks[l] = m_layers[l].empty() ? 0u : *std::max_element(m_layers[l].begin(), m_layers[l].end());
+    m_version++;
+}
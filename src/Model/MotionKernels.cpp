@@ -0,0 +1,407 @@
+/**
+ * @file MotionKernels.cpp
+ * @author Sasha Marie te Rehorst (sasha.marieterehorst@gmail.com)
+ * @author Gael Guinaliu (rodez.gael@gmail.com)
+ * @brief Implémentations scalaire, SSE2 et AVX2 du noyau d'intégration.
+ * @details Chaque voie fait exactement les opérations de la boucle scalaire, dans le même
+ * ordre : les conditions deviennent des masques (sélections), jamais des sauts.
+ * @version 1.0
+ * @date 2026-01-28
+ */
+
+// AUCUN INCLUDE ICI (Géré par CMake), sauf les intrinsèques : ils dépendent de l'architecture.
+
+#if defined(__x86_64__) || defined(_M_X64)
+#define MOTION_HAS_SSE2 1
+#include <emmintrin.h>
+#endif
+
+#if defined(MOTION_HAS_SSE2) && (defined(__GNUC__) || defined(__clang__))
+#define MOTION_HAS_AVX2 1
+#include <immintrin.h>
+#define MOTION_AVX2 __attribute__((target("avx2")))
+#endif
+
+namespace {
+
+// Réduction : 2*pi en deux parties (la première, 201/32, est exacte multipliée par un entier)
+constexpr float INV_TWO_PI = 0.159154943f;
+constexpr float TWO_PI_HI = 6.28125f;
+constexpr float TWO_PI_LO = 1.93530717958647692e-3f;
+constexpr float PI = 3.14159265f;
+constexpr float HALF_PI = 1.57079633f;
+
+// Série de Taylor du sinus (termes impairs 3 à 11)
+constexpr float S3 = -1.f / 6.f;
+constexpr float S5 = 1.f / 120.f;
+constexpr float S7 = -1.f / 5040.f;
+constexpr float S9 = 1.f / 362880.f;
+constexpr float S11 = -1.f / 39916800.f;
+
+// La version AVX2 lit les tables par stade d'une seule permutation (4 entrées)
+static_assert(Config::STAGE_COUNT == 4, "lookupAvx2 suppose 4 stades");
+
+/// Amplitude du cap d'errance (rad) : sin(phase) * WANDER_SWING.
+constexpr float WANDER_SWING = 6.28f;
+
+/**
+ * @struct Columns
+ * @brief Colonnes d'une tranche, décalées sur son premier agent (indice local 0..n-1).
+ */
+struct Columns {
+    float* x;
+    float* y;
+    float* energy;
+    float* cooldown;
+    const float* speed;
+    const float* radius;
+    std::uint8_t* alive;
+    const std::uint8_t* level;
+    const std::uint8_t* seed;
+    const float* steerX;
+    const float* steerY;
+    const std::uint8_t* wander;
+
+    Columns from(std::size_t i) const {
+        return {x + i, y + i, energy + i, cooldown + i, speed + i, radius + i,
+                alive + i, level + i, seed + i, steerX + i, steerY + i, wander + i};
+    }
+};
+
+// -------------------------------------------------------------------------
+// SCALAIRE (référence)
+// -------------------------------------------------------------------------
+
+float sinScalar(float x) {
+    float k = std::nearbyint(x * INV_TWO_PI);
+    float r = (x - k * TWO_PI_HI) - k * TWO_PI_LO;
+    float t = r > HALF_PI ? PI - r : r;
+    t = r < -HALF_PI ? -PI - r : t;
+    float t2 = t * t;
+    float p = S11;
+    p = p * t2 + S9;
+    p = p * t2 + S7;
+    p = p * t2 + S5;
+    p = p * t2 + S3;
+    return t + t * t2 * p;
+}
+
+template <typename Rates>
+void integrateScalar(const Columns& c, std::size_t n, const Motion::Params& p, const Rates& rates) {
+    const float killXMin = p.xMin - Motion::WALL_KILL, killXMax = p.xMax + Motion::WALL_KILL;
+    const float killYMin = p.yMin - Motion::WALL_KILL, killYMax = p.yMax + Motion::WALL_KILL;
+    for (std::size_t i = 0; i < n; ++i) {
+        // Métabolisme : les trous (alive = 0) ne changent pas
+        bool live = c.alive[i] != 0;
+        std::uint8_t level = c.level[i];
+        float energy = c.energy[i] - (live ? rates.loss(level) : 0.f);
+        c.energy[i] = energy;
+        bool moving = live && energy > 0.f;
+        float cooldown = c.cooldown[i];
+        c.cooldown[i] = cooldown - ((live && cooldown > 0.f) ? p.dt : 0.f);
+
+        // Cap : celui de la perception, ou l'errance
+        float phase = p.time * rates.wanderRate(level) + (float)c.seed[i];
+        float angle = sinScalar(phase) * WANDER_SWING;
+        bool wander = c.wander[i] != 0;
+        float dx = wander ? sinScalar(angle + HALF_PI) : c.steerX[i];
+        float dy = wander ? sinScalar(angle) : c.steerY[i];
+
+        float x = moving ? c.x[i] + dx * c.speed[i] * p.dt : c.x[i];
+        float y = moving ? c.y[i] + dy * c.speed[i] * p.dt : c.y[i];
+
+        // Murs : bloqué contre le bord, écrasé s'il est poussé trop loin (laissé en place)
+        float padding = c.radius[i] + Motion::WALL_PADDING;
+        float xLo = p.xMin + padding, xHi = p.xMax - padding;
+        float yLo = p.yMin + padding, yHi = p.yMax - padding;
+        bool crushed = x < killXMin || x > killXMax || y < killYMin || y > killYMax;
+        float cx = x > xHi ? xHi : x;
+        cx = x < xLo ? xLo : cx;
+        float cy = y > yHi ? yHi : y;
+        cy = y < yLo ? yLo : cy;
+        bool survives = moving && !crushed;
+        c.x[i] = survives ? cx : x;
+        c.y[i] = survives ? cy : y;
+        c.alive[i] = survives ? 1 : 0;
+    }
+}
+
+// -------------------------------------------------------------------------
+// SSE2 (4 voies)
+// -------------------------------------------------------------------------
+
+#ifdef MOTION_HAS_SSE2
+inline __m128 selectSse2(__m128 mask, __m128 a, __m128 b) {
+    return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b)); // mask ? a : b
+}
+
+inline __m128i bytesSse2(const std::uint8_t* p) {
+    return _mm_setr_epi32(p[0], p[1], p[2], p[3]);
+}
+
+// Table par stade : sélections successives (pas de permutation variable en SSE2)
+inline __m128 lookupSse2(const float* table, __m128i level) {
+    __m128 v = _mm_set1_ps(table[0]);
+    for (int l = 1; l < (int)Config::STAGE_COUNT; ++l)
+        v = selectSse2(_mm_castsi128_ps(_mm_cmpeq_epi32(level, _mm_set1_epi32(l))), _mm_set1_ps(table[l]), v);
+    return v;
+}
+
+inline __m128 sinSse2(__m128 x) {
+    __m128 k = _mm_cvtepi32_ps(_mm_cvtps_epi32(_mm_mul_ps(x, _mm_set1_ps(INV_TWO_PI)))); // Au plus proche
+    __m128 r = _mm_sub_ps(_mm_sub_ps(x, _mm_mul_ps(k, _mm_set1_ps(TWO_PI_HI))), _mm_mul_ps(k, _mm_set1_ps(TWO_PI_LO)));
+    __m128 t = selectSse2(_mm_cmpgt_ps(r, _mm_set1_ps(HALF_PI)), _mm_sub_ps(_mm_set1_ps(PI), r), r);
+    t = selectSse2(_mm_cmplt_ps(r, _mm_set1_ps(-HALF_PI)), _mm_sub_ps(_mm_set1_ps(-PI), r), t);
+    __m128 t2 = _mm_mul_ps(t, t);
+    __m128 p = _mm_set1_ps(S11);
+    p = _mm_add_ps(_mm_mul_ps(p, t2), _mm_set1_ps(S9));
+    p = _mm_add_ps(_mm_mul_ps(p, t2), _mm_set1_ps(S7));
+    p = _mm_add_ps(_mm_mul_ps(p, t2), _mm_set1_ps(S5));
+    p = _mm_add_ps(_mm_mul_ps(p, t2), _mm_set1_ps(S3));
+    return _mm_add_ps(t, _mm_mul_ps(_mm_mul_ps(t, t2), p));
+}
+
+inline void storeAlive(std::uint8_t* alive, int mask, int lanes) {
+    for (int l = 0; l < lanes; ++l) alive[l] = (std::uint8_t)((mask >> l) & 1);
+}
+
+template <typename Rates>
+void integrateSse2(const Columns& c, std::size_t n, const Motion::Params& p, const Rates& rates) {
+    const __m128 zero = _mm_setzero_ps(), dt = _mm_set1_ps(p.dt), time = _mm_set1_ps(p.time);
+    const __m128 xMin = _mm_set1_ps(p.xMin), xMax = _mm_set1_ps(p.xMax);
+    const __m128 yMin = _mm_set1_ps(p.yMin), yMax = _mm_set1_ps(p.yMax);
+    const __m128 killXMin = _mm_set1_ps(p.xMin - Motion::WALL_KILL), killXMax = _mm_set1_ps(p.xMax + Motion::WALL_KILL);
+    const __m128 killYMin = _mm_set1_ps(p.yMin - Motion::WALL_KILL), killYMax = _mm_set1_ps(p.yMax + Motion::WALL_KILL);
+    const __m128i zeroI = _mm_setzero_si128();
+
+    std::size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m128i level = bytesSse2(c.level + i);
+        __m128 live = _mm_castsi128_ps(_mm_cmpgt_epi32(bytesSse2(c.alive + i), zeroI));
+        __m128 energy = _mm_sub_ps(_mm_loadu_ps(c.energy + i), _mm_and_ps(live, rates.lossSse2(level)));
+        _mm_storeu_ps(c.energy + i, energy);
+        __m128 moving = _mm_and_ps(live, _mm_cmpgt_ps(energy, zero));
+        __m128 cooldown = _mm_loadu_ps(c.cooldown + i);
+        _mm_storeu_ps(c.cooldown + i, _mm_sub_ps(cooldown, _mm_and_ps(_mm_and_ps(live, _mm_cmpgt_ps(cooldown, zero)), dt)));
+
+        __m128 phase = _mm_add_ps(_mm_mul_ps(time, rates.wanderRateSse2(level)), _mm_cvtepi32_ps(bytesSse2(c.seed + i)));
+        __m128 angle = _mm_mul_ps(sinSse2(phase), _mm_set1_ps(WANDER_SWING));
+        __m128 wander = _mm_castsi128_ps(_mm_cmpgt_epi32(bytesSse2(c.wander + i), zeroI));
+        __m128 dx = selectSse2(wander, sinSse2(_mm_add_ps(angle, _mm_set1_ps(HALF_PI))), _mm_loadu_ps(c.steerX + i));
+        __m128 dy = selectSse2(wander, sinSse2(angle), _mm_loadu_ps(c.steerY + i));
+
+        __m128 speed = _mm_loadu_ps(c.speed + i);
+        __m128 x0 = _mm_loadu_ps(c.x + i), y0 = _mm_loadu_ps(c.y + i);
+        __m128 x = selectSse2(moving, _mm_add_ps(x0, _mm_mul_ps(_mm_mul_ps(dx, speed), dt)), x0);
+        __m128 y = selectSse2(moving, _mm_add_ps(y0, _mm_mul_ps(_mm_mul_ps(dy, speed), dt)), y0);
+
+        __m128 padding = _mm_add_ps(_mm_loadu_ps(c.radius + i), _mm_set1_ps(Motion::WALL_PADDING));
+        __m128 xLo = _mm_add_ps(xMin, padding), xHi = _mm_sub_ps(xMax, padding);
+        __m128 yLo = _mm_add_ps(yMin, padding), yHi = _mm_sub_ps(yMax, padding);
+        __m128 crushed = _mm_or_ps(_mm_or_ps(_mm_cmplt_ps(x, killXMin), _mm_cmpgt_ps(x, killXMax)),
+                                   _mm_or_ps(_mm_cmplt_ps(y, killYMin), _mm_cmpgt_ps(y, killYMax)));
+        __m128 cx = selectSse2(_mm_cmpgt_ps(x, xHi), xHi, x);
+        cx = selectSse2(_mm_cmplt_ps(x, xLo), xLo, cx);
+        __m128 cy = selectSse2(_mm_cmpgt_ps(y, yHi), yHi, y);
+        cy = selectSse2(_mm_cmplt_ps(y, yLo), yLo, cy);
+        __m128 survives = _mm_andnot_ps(crushed, moving);
+        _mm_storeu_ps(c.x + i, selectSse2(survives, cx, x));
+        _mm_storeu_ps(c.y + i, selectSse2(survives, cy, y));
+        storeAlive(c.alive + i, _mm_movemask_ps(survives), 4);
+    }
+    integrateScalar(c.from(i), n - i, p, rates);
+}
+#endif
+
+// -------------------------------------------------------------------------
+// AVX2 (8 voies)
+// -------------------------------------------------------------------------
+
+#ifdef MOTION_HAS_AVX2
+MOTION_AVX2 inline __m256i bytesAvx2(const std::uint8_t* p) {
+    return _mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i*)p));
+}
+
+// Table par stade (4 entrées) : permutation dans chaque moitié du registre
+MOTION_AVX2 inline __m256 lookupAvx2(const float* table, __m256i level) {
+    return _mm256_permutevar_ps(_mm256_broadcast_ps((const __m128*)table), level);
+}
+
+MOTION_AVX2 inline __m256 sinAvx2(__m256 x) {
+    __m256 k = _mm256_round_ps(_mm256_mul_ps(x, _mm256_set1_ps(INV_TWO_PI)), _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+    __m256 r = _mm256_sub_ps(_mm256_sub_ps(x, _mm256_mul_ps(k, _mm256_set1_ps(TWO_PI_HI))),
+                             _mm256_mul_ps(k, _mm256_set1_ps(TWO_PI_LO)));
+    __m256 t = _mm256_blendv_ps(r, _mm256_sub_ps(_mm256_set1_ps(PI), r), _mm256_cmp_ps(r, _mm256_set1_ps(HALF_PI), _CMP_GT_OQ));
+    t = _mm256_blendv_ps(t, _mm256_sub_ps(_mm256_set1_ps(-PI), r), _mm256_cmp_ps(r, _mm256_set1_ps(-HALF_PI), _CMP_LT_OQ));
+    __m256 t2 = _mm256_mul_ps(t, t);
+    __m256 p = _mm256_set1_ps(S11);
+    p = _mm256_add_ps(_mm256_mul_ps(p, t2), _mm256_set1_ps(S9));
+    p = _mm256_add_ps(_mm256_mul_ps(p, t2), _mm256_set1_ps(S7));
+    p = _mm256_add_ps(_mm256_mul_ps(p, t2), _mm256_set1_ps(S5));
+    p = _mm256_add_ps(_mm256_mul_ps(p, t2), _mm256_set1_ps(S3));
+    return _mm256_add_ps(t, _mm256_mul_ps(_mm256_mul_ps(t, t2), p));
+}
+
+template <typename Rates>
+MOTION_AVX2 void integrateAvx2(const Columns& c, std::size_t n, const Motion::Params& p, const Rates& rates) {
+    const __m256 zero = _mm256_setzero_ps(), dt = _mm256_set1_ps(p.dt), time = _mm256_set1_ps(p.time);
+    const __m256 xMin = _mm256_set1_ps(p.xMin), xMax = _mm256_set1_ps(p.xMax);
+    const __m256 yMin = _mm256_set1_ps(p.yMin), yMax = _mm256_set1_ps(p.yMax);
+    const __m256 killXMin = _mm256_set1_ps(p.xMin - Motion::WALL_KILL), killXMax = _mm256_set1_ps(p.xMax + Motion::WALL_KILL);
+    const __m256 killYMin = _mm256_set1_ps(p.yMin - Motion::WALL_KILL), killYMax = _mm256_set1_ps(p.yMax + Motion::WALL_KILL);
+    const __m256i zeroI = _mm256_setzero_si256();
+
+    std::size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m256i level = bytesAvx2(c.level + i);
+        __m256 live = _mm256_castsi256_ps(_mm256_cmpgt_epi32(bytesAvx2(c.alive + i), zeroI));
+        __m256 energy = _mm256_sub_ps(_mm256_loadu_ps(c.energy + i), _mm256_and_ps(live, rates.lossAvx2(level)));
+        _mm256_storeu_ps(c.energy + i, energy);
+        __m256 moving = _mm256_and_ps(live, _mm256_cmp_ps(energy, zero, _CMP_GT_OQ));
+        __m256 cooldown = _mm256_loadu_ps(c.cooldown + i);
+        __m256 counting = _mm256_and_ps(live, _mm256_cmp_ps(cooldown, zero, _CMP_GT_OQ));
+        _mm256_storeu_ps(c.cooldown + i, _mm256_sub_ps(cooldown, _mm256_and_ps(counting, dt)));
+
+        __m256 phase = _mm256_add_ps(_mm256_mul_ps(time, rates.wanderRateAvx2(level)),
+                                     _mm256_cvtepi32_ps(bytesAvx2(c.seed + i)));
+        __m256 angle = _mm256_mul_ps(sinAvx2(phase), _mm256_set1_ps(WANDER_SWING));
+        __m256 wander = _mm256_castsi256_ps(_mm256_cmpgt_epi32(bytesAvx2(c.wander + i), zeroI));
+        __m256 dx = _mm256_blendv_ps(_mm256_loadu_ps(c.steerX + i), sinAvx2(_mm256_add_ps(angle, _mm256_set1_ps(HALF_PI))), wander);
+        __m256 dy = _mm256_blendv_ps(_mm256_loadu_ps(c.steerY + i), sinAvx2(angle), wander);
+
+        __m256 speed = _mm256_loadu_ps(c.speed + i);
+        __m256 x0 = _mm256_loadu_ps(c.x + i), y0 = _mm256_loadu_ps(c.y + i);
+        __m256 x = _mm256_blendv_ps(x0, _mm256_add_ps(x0, _mm256_mul_ps(_mm256_mul_ps(dx, speed), dt)), moving);
+        __m256 y = _mm256_blendv_ps(y0, _mm256_add_ps(y0, _mm256_mul_ps(_mm256_mul_ps(dy, speed), dt)), moving);
+
+        __m256 padding = _mm256_add_ps(_mm256_loadu_ps(c.radius + i), _mm256_set1_ps(Motion::WALL_PADDING));
+        __m256 xLo = _mm256_add_ps(xMin, padding), xHi = _mm256_sub_ps(xMax, padding);
+        __m256 yLo = _mm256_add_ps(yMin, padding), yHi = _mm256_sub_ps(yMax, padding);
+        __m256 crushed = _mm256_or_ps(
+            _mm256_or_ps(_mm256_cmp_ps(x, killXMin, _CMP_LT_OQ), _mm256_cmp_ps(x, killXMax, _CMP_GT_OQ)),
+            _mm256_or_ps(_mm256_cmp_ps(y, killYMin, _CMP_LT_OQ), _mm256_cmp_ps(y, killYMax, _CMP_GT_OQ)));
+        __m256 cx = _mm256_blendv_ps(x, xHi, _mm256_cmp_ps(x, xHi, _CMP_GT_OQ));
+        cx = _mm256_blendv_ps(cx, xLo, _mm256_cmp_ps(x, xLo, _CMP_LT_OQ));
+        __m256 cy = _mm256_blendv_ps(y, yHi, _mm256_cmp_ps(y, yHi, _CMP_GT_OQ));
+        cy = _mm256_blendv_ps(cy, yLo, _mm256_cmp_ps(y, yLo, _CMP_LT_OQ));
+        __m256 survives = _mm256_andnot_ps(crushed, moving);
+        _mm256_storeu_ps(c.x + i, _mm256_blendv_ps(x, cx, survives));
+        _mm256_storeu_ps(c.y + i, _mm256_blendv_ps(y, cy, survives));
+        storeAlive(c.alive + i, _mm256_movemask_ps(survives), 8);
+    }
+    integrateSse2(c.from(i), n - i, p, rates);
+}
+#endif
+
+// -------------------------------------------------------------------------
+// TRAITS PAR STADE
+// -------------------------------------------------------------------------
+
+/**
+ * @struct Rates
+ * @brief Perte d'énergie du pas et vitesse d'errance de chaque voie, selon le stade de la voie.
+ */
+template <typename... Stages> struct Rates;
+
+// Table chargée (Config::Custom) : lue à l'exécution, indexée par le stade de chaque voie
+template <> struct Rates<Config::Custom> {
+    float lossTable[Config::STAGE_COUNT];
+    float wanderTable[Config::STAGE_COUNT];
+
+    Rates(float dt, const Config::Custom& traits) {
+        for (std::size_t l = 0; l < Config::STAGE_COUNT; ++l) {
+            lossTable[l] = traits.stage((std::uint8_t)l).energyLoss * dt;
+            wanderTable[l] = traits.stage((std::uint8_t)l).wanderRate;
+        }
+    }
+    float loss(std::uint8_t level) const { return lossTable[level]; }
+    float wanderRate(std::uint8_t level) const { return wanderTable[level]; }
+#ifdef MOTION_HAS_SSE2
+    __m128 lossSse2(__m128i level) const { return lookupSse2(lossTable, level); }
+    __m128 wanderRateSse2(__m128i level) const { return lookupSse2(wanderTable, level); }
+#endif
+#ifdef MOTION_HAS_AVX2
+    MOTION_AVX2 __m256 lossAvx2(__m256i level) const { return lookupAvx2(lossTable, level); }
+    MOTION_AVX2 __m256 wanderRateAvx2(__m256i level) const { return lookupAvx2(wanderTable, level); }
+#endif
+};
+
+// Stades de la table compilée : des constantes, choisies par le masque du stade de chaque voie
+// (un seul stade : aucune sélection, le stade n'est même pas lu)
+template <std::uint8_t First, std::uint8_t... Rest>
+struct Rates<Config::Builtin<First>, Config::Builtin<Rest>...> {
+    float dt;
+
+    Rates(float dt, const Config::Builtin<First>&, const Config::Builtin<Rest>&...) : dt(dt) {}
+
+    template <typename Value>
+    static float choose([[maybe_unused]] std::uint8_t level, Value value) {
+        float v = value(Config::Builtin<First>{});
+        ((v = level == Rest ? value(Config::Builtin<Rest>{}) : v), ...);
+        return v;
+    }
+    float loss(std::uint8_t level) const { return choose(level, [this](auto s) { return decltype(s)::energyLoss * dt; }); }
+    float wanderRate(std::uint8_t level) const { return choose(level, [](auto s) { return decltype(s)::wanderRate; }); }
+
+#ifdef MOTION_HAS_SSE2
+    template <typename Value>
+    static __m128 chooseSse2([[maybe_unused]] __m128i level, Value value) {
+        __m128 v = _mm_set1_ps(value(Config::Builtin<First>{}));
+        ((v = selectSse2(_mm_castsi128_ps(_mm_cmpeq_epi32(level, _mm_set1_epi32(Rest))),
+                         _mm_set1_ps(value(Config::Builtin<Rest>{})), v)), ...);
+        return v;
+    }
+    __m128 lossSse2(__m128i level) const { return chooseSse2(level, [this](auto s) { return decltype(s)::energyLoss * dt; }); }
+    __m128 wanderRateSse2(__m128i level) const { return chooseSse2(level, [](auto s) { return decltype(s)::wanderRate; }); }
+#endif
+
+#ifdef MOTION_HAS_AVX2
+    template <typename Value>
+    MOTION_AVX2 static __m256 chooseAvx2([[maybe_unused]] __m256i level, Value value) {
+        __m256 v = _mm256_set1_ps(value(Config::Builtin<First>{}));
+        ((v = _mm256_blendv_ps(v, _mm256_set1_ps(value(Config::Builtin<Rest>{})),
+                               _mm256_castsi256_ps(_mm256_cmpeq_epi32(level, _mm256_set1_epi32(Rest))))), ...);
+        return v;
+    }
+    MOTION_AVX2 __m256 lossAvx2(__m256i level) const { return chooseAvx2(level, [this](auto s) { return decltype(s)::energyLoss * dt; }); }
+    MOTION_AVX2 __m256 wanderRateAvx2(__m256i level) const { return chooseAvx2(level, [](auto s) { return decltype(s)::wanderRate; }); }
+#endif
+};
+
+} // namespace
+
+// -------------------------------------------------------------------------
+// INTERFACE
+// -------------------------------------------------------------------------
+
+template <typename... Stages>
+void Motion::integrate(Population& pop, std::size_t begin, std::size_t end, const Steering& steering, const Params& params,
+                       const Stages&... stages) {
+    if (end <= begin) return;
+    Columns c{pop.x.data(), pop.y.data(), pop.energy.data(), pop.cooldown.data(), pop.speed.data(), pop.radius.data(),
+              pop.alive.data(), pop.level.data(), pop.seed.data(),
+              steering.x.data(), steering.y.data(), steering.wander.data()};
+    // Colonnes de la population décalées sur begin, direction déjà indexée depuis le début de la tranche
+    Columns local = c.from(begin);
+    local.steerX = c.steerX; local.steerY = c.steerY; local.wander = c.wander;
+    const Rates<Stages...> rates(params.dt, stages...);
+
+    // Même jeu d'instructions que les recherches de voisins (Nearest::setIsa règle les deux)
+    switch (Nearest::activeIsa()) {
+#ifdef MOTION_HAS_AVX2
+        case Nearest::Isa::AVX2: integrateAvx2(local, end - begin, params, rates); break;
+#endif
+#ifdef MOTION_HAS_SSE2
+        case Nearest::Isa::SSE2: integrateSse2(local, end - begin, params, rates); break;
+#endif
+        default: integrateScalar(local, end - begin, params, rates); break;
+    }
+}
+
+// Proies (Bactérie et Poisson) et requins de la table compilée, ou une table chargée
+template void Motion::integrate(Population&, std::size_t, std::size_t, const Steering&, const Params&,
+                                const Config::Builtin<Config::BACTERIA>&, const Config::Builtin<Config::FISH>&);
+template void Motion::integrate(Population&, std::size_t, std::size_t, const Steering&, const Params&,
+                                const Config::Builtin<Config::SHARK>&);
+template void Motion::integrate(Population&, std::size_t, std::size_t, const Steering&, const Params&,
+                                const Config::Custom&);
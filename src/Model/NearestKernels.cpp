@@ -0,0 +1,254 @@
+/**
+ * @file NearestKernels.cpp
+ * @author Sasha Marie te Rehorst (sasha.marieterehorst@gmail.com)
+ * @author Gael Guinaliu (rodez.gael@gmail.com)
+ * @brief Implémentations scalaire, SSE2 et AVX2 des noyaux "plus proche point".
+ * @details Les versions AVX2 sont compilées avec un attribut de cible (GCC / Clang) :
+ * le reste du programme n'exige pas AVX2 et tourne sur tout processeur x86-64.
+ * @version 1.0
+ * @date 2026-01-13
+ */
+
+// AUCUN INCLUDE ICI (Géré par CMake), sauf les intrinsèques : ils dépendent de l'architecture.
+
+#if defined(__x86_64__) || defined(_M_X64)
+#define NEAREST_HAS_SSE2 1
+#include <emmintrin.h>
+#endif
+
+#if defined(NEAREST_HAS_SSE2) && (defined(__GNUC__) || defined(__clang__))
+#define NEAREST_HAS_AVX2 1
+#include <immintrin.h>
+#define NEAREST_AVX2 __attribute__((target("avx2")))
+#endif
+
+namespace {
+
+using ArgMinFn = std::uint32_t (*)(const float*, const float*, std::size_t, float, float, float&);
+using ArgMinBatchFn = void (*)(const float*, const float*, std::size_t, const float*, const float*, std::size_t,
+                               float, std::uint32_t*, float*);
+
+// -------------------------------------------------------------------------
+// SCALAIRE (référence)
+// -------------------------------------------------------------------------
+
+std::uint32_t argMinScalar(const float* xs, const float* ys, std::size_t n, float px, float py, float& bestSq) {
+    std::uint32_t best = Nearest::NONE;
+    for (std::size_t i = 0; i < n; ++i) {
+        float dx = xs[i] - px, dy = ys[i] - py;
+        float d = dx * dx + dy * dy;
+        if (d < bestSq) { bestSq = d; best = (std::uint32_t)i; }
+    }
+    return best;
+}
+
+void argMinBatchScalar(const float* qx, const float* qy, std::size_t nq, const float* xs, const float* ys,
+                       std::size_t n, float maxSq, std::uint32_t* outIndex, float* outDistSq) {
+    for (std::size_t q = 0; q < nq; ++q) {
+        float d = maxSq;
+        outIndex[q] = argMinScalar(xs, ys, n, qx[q], qy[q], d);
+        outDistSq[q] = d;
+    }
+}
+
+// Réduction des voies : plus petite distance, puis plus petit indice (comme la boucle scalaire).
+void reduceLanes(const float* dist, const std::int32_t* index, int lanes, std::uint32_t& best, float& bestSq) {
+    for (int l = 0; l < lanes; ++l) {
+        if (index[l] < 0) continue;
+        if (dist[l] < bestSq || (dist[l] == bestSq && (std::uint32_t)index[l] < best)) {
+            bestSq = dist[l];
+            best = (std::uint32_t)index[l];
+        }
+    }
+}
+
+// -------------------------------------------------------------------------
+// SSE2 (4 voies)
+// -------------------------------------------------------------------------
+
+#ifdef NEAREST_HAS_SSE2
+inline __m128i selectSse2(__m128i mask, __m128i a, __m128i b) {
+    return _mm_or_si128(_mm_and_si128(mask, a), _mm_andnot_si128(mask, b)); // mask ? a : b
+}
+
+std::uint32_t argMinSse2(const float* xs, const float* ys, std::size_t n, float px, float py, float& bestSq) {
+    std::size_t i = 0;
+    std::uint32_t best = Nearest::NONE;
+    if (n >= 4) {
+        const __m128 qx = _mm_set1_ps(px), qy = _mm_set1_ps(py);
+        const __m128i step = _mm_set1_epi32(4);
+        __m128 bestD = _mm_set1_ps(bestSq);
+        __m128i bestI = _mm_set1_epi32(-1);
+        __m128i idx = _mm_setr_epi32(0, 1, 2, 3);
+        for (; i + 4 <= n; i += 4) {
+            __m128 dx = _mm_sub_ps(_mm_loadu_ps(xs + i), qx);
+            __m128 dy = _mm_sub_ps(_mm_loadu_ps(ys + i), qy);
+            __m128 d = _mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy));
+            __m128 lt = _mm_cmplt_ps(d, bestD);
+            bestD = _mm_or_ps(_mm_and_ps(lt, d), _mm_andnot_ps(lt, bestD));
+            bestI = selectSse2(_mm_castps_si128(lt), idx, bestI);
+            idx = _mm_add_epi32(idx, step);
+        }
+        alignas(16) float dist[4];
+        alignas(16) std::int32_t index[4];
+        _mm_store_ps(dist, bestD);
+        _mm_store_si128((__m128i*)index, bestI);
+        reduceLanes(dist, index, 4, best, bestSq);
+    }
+    for (; i < n; ++i) {
+        float dx = xs[i] - px, dy = ys[i] - py;
+        float d = dx * dx + dy * dy;
+        if (d < bestSq) { bestSq = d; best = (std::uint32_t)i; }
+    }
+    return best;
+}
+
+void argMinBatchSse2(const float* qx, const float* qy, std::size_t nq, const float* xs, const float* ys,
+                     std::size_t n, float maxSq, std::uint32_t* outIndex, float* outDistSq) {
+    std::size_t q = 0;
+    for (; q + 4 <= nq; q += 4) {
+        const __m128 px = _mm_loadu_ps(qx + q), py = _mm_loadu_ps(qy + q);
+        __m128 bestD = _mm_set1_ps(maxSq);
+        __m128i bestI = _mm_set1_epi32(-1);
+        for (std::size_t j = 0; j < n; ++j) {
+            __m128 dx = _mm_sub_ps(_mm_set1_ps(xs[j]), px);
+            __m128 dy = _mm_sub_ps(_mm_set1_ps(ys[j]), py);
+            __m128 d = _mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy));
+            __m128 lt = _mm_cmplt_ps(d, bestD);
+            bestD = _mm_or_ps(_mm_and_ps(lt, d), _mm_andnot_ps(lt, bestD));
+            bestI = selectSse2(_mm_castps_si128(lt), _mm_set1_epi32((std::int32_t)j), bestI);
+        }
+        _mm_storeu_ps(outDistSq + q, bestD);
+        _mm_storeu_si128((__m128i*)(outIndex + q), bestI); // -1 == NONE
+    }
+    argMinBatchScalar(qx + q, qy + q, nq - q, xs, ys, n, maxSq, outIndex + q, outDistSq + q);
+}
+#endif
+
+// -------------------------------------------------------------------------
+// AVX2 (8 voies)
+// -------------------------------------------------------------------------
+
+#ifdef NEAREST_HAS_AVX2
+NEAREST_AVX2 std::uint32_t argMinAvx2(const float* xs, const float* ys, std::size_t n, float px, float py, float& bestSq) {
+    std::size_t i = 0;
+    std::uint32_t best = Nearest::NONE;
+    if (n >= 8) {
+        const __m256 qx = _mm256_set1_ps(px), qy = _mm256_set1_ps(py);
+        const __m256i step = _mm256_set1_epi32(8);
+        __m256 bestD = _mm256_set1_ps(bestSq);
+        __m256i bestI = _mm256_set1_epi32(-1);
+        __m256i idx = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+        for (; i + 8 <= n; i += 8) {
+            __m256 dx = _mm256_sub_ps(_mm256_loadu_ps(xs + i), qx);
+            __m256 dy = _mm256_sub_ps(_mm256_loadu_ps(ys + i), qy);
+            __m256 d = _mm256_add_ps(_mm256_mul_ps(dx, dx), _mm256_mul_ps(dy, dy));
+            __m256 lt = _mm256_cmp_ps(d, bestD, _CMP_LT_OQ);
+            bestD = _mm256_blendv_ps(bestD, d, lt);
+            bestI = _mm256_blendv_epi8(bestI, idx, _mm256_castps_si256(lt));
+            idx = _mm256_add_epi32(idx, step);
+        }
+        alignas(32) float dist[8];
+        alignas(32) std::int32_t index[8];
+        _mm256_store_ps(dist, bestD);
+        _mm256_store_si256((__m256i*)index, bestI);
+        reduceLanes(dist, index, 8, best, bestSq);
+    }
+    for (; i < n; ++i) {
+        float dx = xs[i] - px, dy = ys[i] - py;
+        float d = dx * dx + dy * dy;
+        if (d < bestSq) { bestSq = d; best = (std::uint32_t)i; }
+    }
+    return best;
+}
+
+NEAREST_AVX2 void argMinBatchAvx2(const float* qx, const float* qy, std::size_t nq, const float* xs, const float* ys,
+                                  std::size_t n, float maxSq, std::uint32_t* outIndex, float* outDistSq) {
+    std::size_t q = 0;
+    for (; q + 8 <= nq; q += 8) {
+        const __m256 px = _mm256_loadu_ps(qx + q), py = _mm256_loadu_ps(qy + q);
+        __m256 bestD = _mm256_set1_ps(maxSq);
+        __m256i bestI = _mm256_set1_epi32(-1);
+        for (std::size_t j = 0; j < n; ++j) {
+            __m256 dx = _mm256_sub_ps(_mm256_set1_ps(xs[j]), px);
+            __m256 dy = _mm256_sub_ps(_mm256_set1_ps(ys[j]), py);
+            __m256 d = _mm256_add_ps(_mm256_mul_ps(dx, dx), _mm256_mul_ps(dy, dy));
+            __m256 lt = _mm256_cmp_ps(d, bestD, _CMP_LT_OQ);
+            bestD = _mm256_blendv_ps(bestD, d, lt);
+            bestI = _mm256_blendv_epi8(bestI, _mm256_set1_epi32((std::int32_t)j), _mm256_castps_si256(lt));
+        }
+        _mm256_storeu_ps(outDistSq + q, bestD);
+        _mm256_storeu_si256((__m256i*)(outIndex + q), bestI);
+    }
+    argMinBatchSse2(qx + q, qy + q, nq - q, xs, ys, n, maxSq, outIndex + q, outDistSq + q);
+}
+#endif
+
+// -------------------------------------------------------------------------
+// SÉLECTION À L'EXÉCUTION
+// -------------------------------------------------------------------------
+
+struct Dispatch {
+    Nearest::Isa isa;
+    ArgMinFn argMin;
+    ArgMinBatchFn argMinBatch;
+};
+
+Dispatch makeDispatch(Nearest::Isa isa) {
+    switch (isa) {
+#ifdef NEAREST_HAS_AVX2
+        case Nearest::Isa::AVX2: return {isa, argMinAvx2, argMinBatchAvx2};
+#endif
+#ifdef NEAREST_HAS_SSE2
+        case Nearest::Isa::SSE2: return {isa, argMinSse2, argMinBatchSse2};
+#endif
+        default: return {Nearest::Isa::Scalar, argMinScalar, argMinBatchScalar};
+    }
+}
+
+Dispatch& dispatch() {
+    static Dispatch d = makeDispatch(Nearest::detectIsa());
+    return d;
+}
+
+} // namespace
+
+// -------------------------------------------------------------------------
+// INTERFACE
+// -------------------------------------------------------------------------
+
+Nearest::Isa Nearest::detectIsa() {
+#if defined(NEAREST_HAS_AVX2)
+    if (__builtin_cpu_supports("avx2")) return Isa::AVX2;
+#endif
+#if defined(NEAREST_HAS_SSE2)
+    return Isa::SSE2; // Toujours présent en x86-64
+#else
+    return Isa::Scalar;
+#endif
+}
+
+Nearest::Isa Nearest::activeIsa() { return dispatch().isa; }
+
+void Nearest::setIsa(Isa isa) {
+    if ((int)isa > (int)detectIsa()) isa = detectIsa();
+    dispatch() = makeDispatch(isa);
+}
+
+const char* Nearest::isaName(Isa isa) {
+    switch (isa) {
+        case Isa::AVX2: return "AVX2";
+        case Isa::SSE2: return "SSE2";
+        default:        return "scalaire";
+    }
+}
+
+std::uint32_t Nearest::argMin(const float* xs, const float* ys, std::size_t n, float px, float py, float& bestSq) {
+    return dispatch().argMin(xs, ys, n, px, py, bestSq);
+}
+
+void Nearest::argMinBatch(const float* qx, const float* qy, std::size_t nq,
+                          const float* xs, const float* ys, std::size_t n, float maxSq,
+                          std::uint32_t* outIndex, float* outDistSq) {
+    dispatch().argMinBatch(qx, qy, nq, xs, ys, n, maxSq, outIndex, outDistSq);
+}
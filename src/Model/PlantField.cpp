@@ -0,0 +1,196 @@
+/**
+ * @file PlantField.cpp
+ * @author Sasha Marie te Rehorst (sasha.marieterehorst@gmail.com)
+ * @author Gael Guinaliu (rodez.gael@gmail.com)
+ * @brief Champ d'algues : repousse et recherche de la cellule la plus proche.
+ * @version 1.0
+ * @date 2026-01-17
+ */
+
+// AUCUN INCLUDE ICI (Géré par CMake)
+
+// Probabilités de repousse par passage sur une cellule (sur 65536). Un passage toutes les
+// REGROW_PERIOD étapes : à 60 pas/s, une cellule est visitée deux fois par seconde.
+static constexpr std::uint32_t GROW_CHANCE = 8192;      // Cellule occupée : +1 (1 sur 8)
+static constexpr std::uint32_t SPREAD_CHANCE = 1024;    // Cellule vide, par algue voisine (4-voisinage)
+static constexpr std::uint32_t SPONTANEOUS_CHANCE = 16; // Cellule vide isolée (spore venue d'ailleurs)
+
+/**
+ * @brief Tirage 16 bits reproductible pour (cellule, passage) (mélangeur de splitmix32).
+ */
+static std::uint32_t cellRandom(std::uint32_t cell, std::uint32_t tick) {
+    std::uint32_t h = cell * 0x9E3779B9u ^ (tick + 0x7F4A7C15u) * 0x85EBCA6Bu;
+    h ^= h >> 16; h *= 0x7FEB352Du;
+    h ^= h >> 15; h *= 0x846CA68Bu;
+    h ^= h >> 16;
+    return h & 0xFFFFu;
+}
+
+// -------------------------------------------------------------------------
+// MODÈLES DE PLANTES
+// -------------------------------------------------------------------------
+
+const char* plantModelName(PlantModel model) {
+    return model == PlantModel::Field ? "field" : "individual";
+}
+
+std::optional<PlantModel> plantModelFromName(const std::string& name) {
+    if (name == "individual") return PlantModel::Individual;
+    if (name == "field") return PlantModel::Field;
+    return std::nullopt;
+}
+
+// -------------------------------------------------------------------------
+// CONFIGURATION
+// -------------------------------------------------------------------------
+
+void PlantField::reset(float xMin, float xMax, float yMin, float yMax, float cellSize) {
+    // Ancien champ conservé pour y reprendre la biomasse
+    std::vector<std::uint8_t> old;
+    old.swap(m_biomass);
+    int oldCols = m_cols;
+    float oldX = m_xMin, oldY = m_yMin, oldCell = m_cellSize;
+
+    m_xMin = xMin; m_yMin = yMin;
+    m_cellSize = std::max(1.f, cellSize);
+    m_invCell = 1.f / m_cellSize;
+    m_cols = std::max(1, (int)std::ceil(std::max(1.f, xMax - xMin) * m_invCell));
+    m_rows = std::max(1, (int)std::ceil(std::max(1.f, yMax - yMin) * m_invCell));
+    m_biomass.assign((std::size_t)m_cols * (std::size_t)m_rows, 0);
+    m_blockCols = (m_cols + BLOCK - 1) / BLOCK;
+    m_blockRows = (m_rows + BLOCK - 1) / BLOCK;
+    m_blockCount.assign((std::size_t)m_blockCols * (std::size_t)m_blockRows, 0);
+    m_total = 0;
+    m_tick = 0;
+
+    for (std::size_t c = 0; c < old.size(); ++c) {
+        if (!old[c]) continue;
+        sf::Vector2f center(oldX + ((float)(c % oldCols) + 0.5f) * oldCell, oldY + ((float)(c / oldCols) + 0.5f) * oldCell);
+        for (std::uint8_t k = 0; k < old[c]; ++k) add(center);
+    }
+}
+
+void PlantField::clear() {
+    std::fill(m_biomass.begin(), m_biomass.end(), 0);
+    std::fill(m_blockCount.begin(), m_blockCount.end(), 0);
+    m_total = 0;
+}
+
+bool PlantField::assign(const std::vector<std::uint8_t>& cells, std::uint32_t tick) {
+    if (cells.size() != m_biomass.size()) return false;
+    clear();
+    for (std::uint32_t c = 0; c < (std::uint32_t)cells.size(); ++c) {
+        std::uint8_t b = std::min(cells[c], MAX_BIOMASS);
+        if (!b) continue;
+        m_biomass[c] = b;
+        markBlock(c, +1);
+        m_total += b;
+    }
+    m_tick = tick;
+    return true;
+}
+
+// -------------------------------------------------------------------------
+// BIOMASSE
+// -------------------------------------------------------------------------
+
+bool PlantField::add(sf::Vector2f p) {
+    std::uint32_t cell = cellOf(p);
+    std::uint8_t& b = m_biomass[cell];
+    if (b >= MAX_BIOMASS) return false;
+    if (b++ == 0) markBlock(cell, +1);
+    m_total++;
+    return true;
+}
+
+void PlantField::set(std::uint32_t cell, std::uint8_t biomass) {
+    std::uint8_t& b = m_biomass[cell];
+    biomass = std::min(biomass, MAX_BIOMASS);
+    if (!b && biomass) markBlock(cell, +1);
+    else if (b && !biomass) markBlock(cell, -1);
+    m_total += biomass;
+    m_total -= b;
+    b = biomass;
+}
+
+bool PlantField::graze(std::uint32_t cell) {
+    std::uint8_t& b = m_biomass[cell];
+    if (b == 0) return false;
+    if (--b == 0) markBlock(cell, -1);
+    m_total--;
+    return true;
+}
+
+void PlantField::regrow() {
+    int band = (m_rows + REGROW_PERIOD - 1) / REGROW_PERIOD;
+    int y0 = (int)(m_tick % REGROW_PERIOD) * band, y1 = std::min(m_rows, y0 + band);
+    std::uint32_t tick = m_tick++;
+
+    for (int y = y0; y < y1; ++y) {
+        std::uint8_t* row = &m_biomass[(std::size_t)y * m_cols];
+        const std::uint8_t* up = y > 0 ? row - m_cols : nullptr;
+        const std::uint8_t* down = y + 1 < m_rows ? row + m_cols : nullptr;
+        for (int x = 0; x < m_cols; ++x) {
+            std::uint8_t b = row[x];
+            if (b >= MAX_BIOMASS) continue;
+
+            std::uint32_t chance;
+            if (b > 0) {
+                chance = GROW_CHANCE;
+            } else {
+                std::uint32_t neighbours = (x > 0 ? row[x - 1] : 0) + (x + 1 < m_cols ? row[x + 1] : 0)
+                                         + (up ? up[x] : 0) + (down ? down[x] : 0);
+                chance = neighbours ? neighbours * SPREAD_CHANCE : SPONTANEOUS_CHANCE;
+            }
+            std::uint32_t cell = (std::uint32_t)(y * m_cols + x);
+            if (cellRandom(cell, tick) < chance) {
+                if (b == 0) markBlock(cell, +1);
+                row[x] = b + 1; m_total++;
+            }
+        }
+    }
+}
+
+// -------------------------------------------------------------------------
+// REQUÊTES
+// -------------------------------------------------------------------------
+
+template <typename Fn>
+void PlantField::forEachInBlock(int bx, int by, Fn fn) const {
+    int x0 = bx * BLOCK, x1 = std::min(m_cols, x0 + BLOCK);
+    int y0 = by * BLOCK, y1 = std::min(m_rows, y0 + BLOCK);
+    for (int y = y0; y < y1; ++y) {
+        const std::uint8_t* row = &m_biomass[(std::size_t)y * m_cols];
+        for (int x = x0; x < x1; ++x) if (row[x]) fn(x, y);
+    }
+}
+
+std::optional<sf::Vector2f> PlantField::nearest(sf::Vector2f p, float r, float* outDistSq) const {
+    std::optional<sf::Vector2f> best;
+    float bestSq = r * r;
+    float blockSize = BLOCK * m_cellSize;
+    int bx = cellX(p.x) / BLOCK, by = cellY(p.y) / BLOCK;
+    int maxRing = (int)std::ceil(std::min(r / blockSize, (float)std::max(m_blockCols, m_blockRows))) + 1; // Au plus la grille
+
+    auto visit = [&](int x, int y) {
+        if (x < 0 || x >= m_blockCols || y < 0 || y >= m_blockRows || !m_blockCount[(std::size_t)y * m_blockCols + x]) return;
+        forEachInBlock(x, y, [&](int cx, int cy) {
+            sf::Vector2f center(m_xMin + ((float)cx + 0.5f) * m_cellSize, m_yMin + ((float)cy + 0.5f) * m_cellSize);
+            float dx = center.x - p.x, dy = center.y - p.y;
+            float d = dx * dx + dy * dy;
+            if (d < bestSq) { bestSq = d; best = center; }
+        });
+    };
+
+    for (int ring = 0; ring <= maxRing; ++ring) {
+        // Tout point d'un anneau >= ring est à au moins (ring - 1) blocs du point.
+        float ringDist = (ring - 1) * blockSize;
+        if (ring > 0 && ringDist > 0.f && ringDist * ringDist >= bestSq) break;
+        if (ring == 0) { visit(bx, by); continue; }
+        int x0 = bx - ring, x1 = bx + ring, y0 = by - ring, y1 = by + ring;
+        for (int x = x0; x <= x1; ++x) { visit(x, y0); visit(x, y1); }
+        for (int y = y0 + 1; y < y1; ++y) { visit(x0, y); visit(x1, y); }
+    }
+    if (best && outDistSq) *outDistSq = bestSq;
+    return best;
+}
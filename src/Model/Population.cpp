@@ -0,0 +1,78 @@
+/**
+ * @file Population.cpp
+ * @author Sasha Marie te Rehorst (sasha.marieterehorst@gmail.com)
+ * @author Gael Guinaliu (rodez.gael@gmail.com)
+ * @brief Implémentation du stockage en colonnes et de la physique commune.
+ * @version 2.0
+ * @date 2026-01-09
+ */
+
+// AUCUN INCLUDE ICI (Géré par CMake)
+
+// -------------------------------------------------------------------------
+// GESTION DU STOCKAGE
+// -------------------------------------------------------------------------
+
+std::size_t Population::add(sf::Vector2f p, float e, float r, float s, float cd, std::uint8_t lvl, std::uint8_t sd) {
+    // Toutes les colonnes grandissent ensemble, par doublement : une réallocation de chaque
+    // colonne au même pas, plutôt que des réallocations dispersées.
+    if (x.size() == x.capacity()) reserve(std::max<std::size_t>(64, 2 * x.size()));
+    x.push_back(p.x); y.push_back(p.y);
+    energy.push_back(e); radius.push_back(r);
+    speed.push_back(s); cooldown.push_back(cd);
+    level.push_back(lvl); eaten.push_back(0);
+    alive.push_back(1); seed.push_back(sd);
+    indexCell.push_back(NOT_INDEXED);
+    return x.size() - 1;
+}
+
+void Population::reserve(std::size_t n) {
+    x.reserve(n); y.reserve(n); energy.reserve(n); radius.reserve(n); speed.reserve(n);
+    cooldown.reserve(n); level.reserve(n); eaten.reserve(n); alive.reserve(n); seed.reserve(n);
+    indexCell.reserve(n);
+}
+
+void Population::clear() { truncate(0); }
+
+void Population::copy(std::size_t from, std::size_t to) {
+    x[to] = x[from]; y[to] = y[from];
+    energy[to] = energy[from]; radius[to] = radius[from];
+    speed[to] = speed[from]; cooldown[to] = cooldown[from];
+    level[to] = level[from]; eaten[to] = eaten[from];
+    alive[to] = alive[from]; seed[to] = seed[from];
+    indexCell[to] = indexCell[from];
+}
+
+void Population::truncate(std::size_t n) {
+    x.resize(n); y.resize(n); energy.resize(n); radius.resize(n); speed.resize(n);
+    cooldown.resize(n); level.resize(n); eaten.resize(n); alive.resize(n); seed.resize(n);
+    indexCell.resize(n);
+}
+
+// -------------------------------------------------------------------------
+// MÉTHODES
+// -------------------------------------------------------------------------
+
+void resolveCollision(Population& a, std::size_t i, Population& b, std::size_t j) {
+    if (!a.alive[i] || !b.alive[j]) return;
+
+    float dx = a.x[i] - b.x[j];
+    float dy = a.y[i] - b.y[j];
+    float distSq = dx*dx + dy*dy; // Distance au carré (très rapide)
+
+    float minDist = a.radius[i] + b.radius[j];
+    float minDistSq = minDist * minDist;
+
+    // On évite la racine carrée (sqrt) tant qu'on n'est pas sûr qu'il y a collision.
+    if (distSq < minDistSq && distSq > 0.0001f) {
+        
+        // Maintenant qu'on sait qu'on se touche, on fait le calcul précis
+        float d = std::sqrt(distSq);
+        float overlap = minDist - d;
+        
+        // Réponse physique : on s'écarte (direction normalisée * moitié du chevauchement)
+        float k = (overlap * 0.5f) / d;
+        a.x[i] += dx * k; a.y[i] += dy * k;
+        b.x[j] -= dx * k; b.y[j] -= dy * k;
+    }
+}
@@ -0,0 +1,96 @@
+/**
+ * @file RenderSnapshot.cpp
+ * @author Sasha Marie te Rehorst (sasha.marieterehorst@gmail.com)
+ * @author Gael Guinaliu (rodez.gael@gmail.com)
+ * @brief Préparation des images du rendu (thread de simulation).
+ * @version 1.0
+ * @date 2026-01-26
+ */
+
+// AUCUN INCLUDE ICI (Géré par CMake)
+
+// -------------------------------------------------------------------------
+// INDEX DE RÉGION
+// -------------------------------------------------------------------------
+
+void RegionIndex::build(const Population& pop, sf::Vector2f min, sf::Vector2f max) {
+    // Seules les vivantes : les trous parqués hors du monde ne s'entassent pas dans une cellule du bord
+    items.clear();
+    for (std::uint32_t i = 0; i < pop.size(); ++i)
+        if (pop.alive[i]) items.push_back(i);
+    grid.build(min.x, max.x, min.y, max.y, CELL_SIZE, items.size(),
+               [&](std::size_t k) { return pop.pos(items[k]); });
+}
+
+void RegionIndex::build(const std::vector<Grass>& plants, sf::Vector2f min, sf::Vector2f max) {
+    items.clear();
+    for (std::uint32_t i = 0; i < plants.size(); ++i)
+        if (plants[i].alive) items.push_back(i);
+    grid.build(min.x, max.x, min.y, max.y, CELL_SIZE, items.size(),
+               [&](std::size_t k) { return plants[items[k]].pos; });
+}
+
+// -------------------------------------------------------------------------
+// CAPTURE
+// -------------------------------------------------------------------------
+
+/// Recopie les colonnes que la Vue dessine (les autres restent vides).
+static void copyShown(const Population& from, Population& to) {
+    to.x = from.x; to.y = from.y;
+    to.radius = from.radius;
+    to.level = from.level;
+    to.alive = from.alive;
+}
+
+/**
+ * @brief Positions de départ de l'interpolation : celles de @p before pour les emplacements
+ * qui désignent encore la même entité, sinon la position actuelle (pas de mouvement).
+ */
+static void startPositions(const Population& now, const Population* before, std::vector<sf::Vector2f>& out) {
+    out.resize(now.size());
+    std::size_t kept = before ? std::min(before->size(), now.size()) : 0;
+    for (std::size_t i = 0; i < kept; ++i) out[i] = before->pos(i);
+    for (std::size_t i = kept; i < now.size(); ++i) out[i] = now.pos(i);
+}
+
+void RenderSnapshot::capture(const World& world, const RenderSnapshot* previous, bool wantDensity, double now) {
+    PROFILE_SCOPE("image du rendu");
+    boundsMin = world.getBoundsMin();
+    boundsMax = world.getBoundsMax();
+    stats = world.getStats();
+    step = world.stepCount();
+    epoch = world.epoch();
+    sequence = previous ? previous->sequence + 1 : 1;
+    preyLayout = world.preyLayout();
+    sharkLayout = world.sharkLayout();
+
+    plantModel = world.plantModel();
+    bool sameWorld = previous && previous->epoch == epoch;
+    withDensity = wantDensity;
+    if (withDensity) {
+        // Vue d'ensemble : seule la grille est dessinée, comptée directement sur le monde.
+        // Aucune colonne recopiée : le coût de l'image ne dépend plus de la population.
+        if (!density.covers(boundsMin.x, boundsMax.x, boundsMin.y, boundsMax.y))
+            density.reset(boundsMin.x, boundsMax.x, boundsMin.y, boundsMax.y);
+        density.bin(plantModel, world.getPlants().slots(), world.getPlantField(), world.getPrey(), world.getSharks());
+        // Vides (capacité conservée) : l'image suivante n'interpole pas depuis des colonnes périmées
+        plants.clear(); prey.clear(); sharks.clear();
+        preyFrom.clear(); sharksFrom.clear();
+    } else {
+        if (plantModel == PlantModel::Field) { field = world.getPlantField(); plants.clear(); }
+        else plants = world.getPlants().slots();
+        copyShown(world.getPrey(), prey);
+        copyShown(world.getSharks(), sharks);
+
+        // Même emplacement, même entité : tant que le monde n'a été ni remis à zéro ni compacté
+        startPositions(prey, sameWorld && previous->preyLayout == preyLayout ? &previous->prey : nullptr, preyFrom);
+        startPositions(sharks, sameWorld && previous->sharkLayout == sharkLayout ? &previous->sharks : nullptr, sharksFrom);
+
+        plantRegions.build(plants, boundsMin, boundsMax);
+        preyRegions.build(prey, boundsMin, boundsMax);
+        sharkRegions.build(sharks, boundsMin, boundsMax);
+    }
+
+    interval = sameWorld ? now - previous->publishedAt : 0.0;
+    publishedAt = now;
+}
@@ -5,75 +5,95 @@
 
 // AUCUN INCLUDE ICI
 
-Sheep::Sheep(sf::Vector2f position) 
-    : Entity(position, 50.f, sf::Color(0, 255, 100, 150), 4.f) // Vert translucide (Bactérie)
-{
-    speed = 40.f; energy = 50.f; m_reproCooldown = 3.0f;
-    m_eatenGrass = 0; m_level = 1; 
+std::size_t Sheep::spawn(Population& prey, sf::Vector2f position, std::uint8_t wanderSeed, const Config::StageTable& stages) {
+    // Bactérie : vert translucide, petite et lente
+    const Config::StageTraits& t = stages[Config::BACTERIA];
+    return prey.add(position, t.birthEnergy, t.radius, t.speed, t.birthCooldown, Config::BACTERIA, wanderSeed);
 }
 
-void Sheep::update(float dt) {
-    if (!alive) return;
-    float loss = (m_level == 1) ? 1.0f : 2.5f;
-    energy -= loss * dt;
-    if (energy <= 0) alive = false;
-    if (m_reproCooldown > 0) m_reproCooldown -= dt;
+void Sheep::becomeStage(Population& prey, std::size_t i, std::uint8_t level, const Config::StageTable& stages) {
+    // Poisson : plus gros et deux fois plus rapide (la couleur suit le stade, dans la Vue)
+    prey.level[i] = level; prey.speed[i] = stages[level].speed; prey.radius[i] = stages[level].radius;
 }
 
-void Sheep::moveAI(float dt, const std::vector<Wolf>& sharks, const std::list<Grass>& plants, float simTime) {
-    if (!alive) return;
-    sf::Vector2f moveDir(0.f, 0.f);
-    
-    // 1. FUIR LES REQUINS (Uniquement si on est un Poisson)
-    const Wolf* danger = nullptr;
-    if (m_level == 2) {
-        float minDangerSq = 150.f * 150.f;
-        for (const auto& w : sharks) {
-            float d = (pos.x - w.pos.x)*(pos.x - w.pos.x) + (pos.y - w.pos.y)*(pos.y - w.pos.y);
-            if (d < minDangerSq) { minDangerSq = d; danger = &w; }
+template <typename Traits>
+void Sheep::findDangers(const Population& prey, std::size_t begin, std::size_t end, const PopulationSnapshot& sharks,
+                        Dangers& out, const Traits& traits) {
+    out.fish.clear(); out.qx.clear(); out.qy.clear();
+    if constexpr (Traits::FLEES) {
+        // Seuls les stades qui fuient (Builtin : le test de portée est une constante)
+        for (std::size_t i = begin; i < end; ++i) {
+            if (!prey.alive[i] || !traits.has(prey.level[i]) || traits.stage(prey.level[i]).fleeRange <= 0.f) continue;
+            out.fish.push_back((std::uint32_t)i);
+            out.qx.push_back(prey.x[i]); out.qy.push_back(prey.y[i]);
         }
+        // Une seule recherche à la plus grande portée, puis la portée du stade de chacun
+        float maxRange = traits.maxFleeRange();
+        out.shark.resize(out.fish.size());
+        out.distSq.resize(out.fish.size());
+        Nearest::argMinBatch(out.qx.data(), out.qy.data(), out.fish.size(), sharks.x.data(), sharks.y.data(), sharks.size(),
+                             maxRange * maxRange, out.shark.data(), out.distSq.data());
+        for (std::size_t k = 0; k < out.fish.size(); ++k) {
+            float range = traits.stage(prey.level[out.fish[k]]).fleeRange;
+            if (out.distSq[k] >= range * range) out.shark[k] = Nearest::NONE;
+        }
+    } else {
+        out.shark.clear(); out.distSq.clear();
     }
+}
 
-    if (danger) {
-        sf::Vector2f diff = pos - danger->pos;
-        float len = std::sqrt((pos.x - danger->pos.x)*(pos.x - danger->pos.x) + (pos.y - danger->pos.y)*(pos.y - danger->pos.y));
-        if (len > 0.1f) moveDir = (diff / len) * 1.8f;
-    } else {
-        // 2. CHERCHER DES PLANTES
-        sf::Vector2f targetPos = pos; bool found = false; float minSq = 350.f * 350.f;
-        for (const auto& p : plants) {
-            float d = (pos.x - p.pos.x)*(pos.x - p.pos.x) + (pos.y - p.pos.y)*(pos.y - p.pos.y);
-            if (d < minSq) { minSq = d; targetPos = p.pos; found = true; }
-        }
-        if (found) {
-            sf::Vector2f diff = targetPos - pos; float len = std::sqrt(minSq);
-            if (len > 0.1f) moveDir = diff / len;
-        } else {
-            long long seed = (long long)this % 100;
-            float angle = std::sin(simTime * 0.4f + seed) * 6.28f;
-            moveDir = {std::cos(angle), std::sin(angle)};
+template <typename Traits>
+std::optional<sf::Vector2f> Sheep::steer(const Population& prey, std::size_t i, std::uint32_t danger,
+                                         const PopulationSnapshot& sharks, const std::optional<Food>& food, const Traits& traits) {
+    sf::Vector2f pos = prey.pos(i);
+
+    // 1. FUIR LES REQUINS (Uniquement si on est un Poisson, requin trouvé par findDangers)
+    if constexpr (Traits::FLEES) {
+        if (danger != Nearest::NONE) {
+            sf::Vector2f diff = pos - sharks.pos(danger);
+            float len = std::sqrt(diff.x * diff.x + diff.y * diff.y);
+            if (len > 0.1f) return (diff / len) * traits.stage(prey.level[i]).fleeBoost;
+            return sf::Vector2f(0.f, 0.f);
         }
     }
-    pos += moveDir * speed * dt;
+    // 2. ALLER VERS LA PLANTE LA PLUS PROCHE
+    if (food) {
+        sf::Vector2f diff = food->pos - pos; float len = std::sqrt(food->distSq);
+        if (len > 0.1f) return diff / len;
+        return sf::Vector2f(0.f, 0.f);
+    }
+    // 3. ERRER
+    return std::nullopt;
 }
 
-void Sheep::eatGrass() {
-    energy += 25.f; if (energy > maxEnergy) energy = maxEnergy;
-    m_eatenGrass++;
+bool Sheep::eatGrass(Population& prey, std::size_t i, const Config::StageTable& stages) {
+    const Config::StageTraits& t = stages[prey.level[i]];
+    prey.energy[i] = std::min(prey.energy[i] + t.mealEnergy, t.maxEnergy);
+    prey.eaten[i]++;
 
-    if (m_eatenGrass >= 5) {
-        m_eatenGrass = 0;
-        m_level++;
-        if (m_level == 2) { // Devenir Poisson
-            speed = 80.f; maxEnergy = 100.f; radius = 8.f;
-            shape.setRadius(radius); shape.setOrigin({radius, radius});
-            shape.setFillColor(sf::Color(0, 150, 255)); // Bleu
-            std::cout << "EVOLUTION : Poisson !" << std::endl;
-        }
-        // Le passage au niveau 3 (Requin) est capté par Simulation.cpp
+    if (t.mealsToEvolve > 0 && prey.eaten[i] >= t.mealsToEvolve) {
+        prey.eaten[i] = 0;
+        prey.level[i]++;
+        if (prey.level[i] < Config::SHARK) becomeStage(prey, i, prey.level[i], stages); // Devenir Poisson
+        // Le passage au niveau 3 (Requin) est capté par World::update
+        return true;
     }
+    return false;
+}
+
+bool Sheep::canReproduce(const Population& prey, std::size_t i, const Config::StageTable& stages) {
+    const Config::StageTraits& t = stages[prey.level[i]];
+    return prey.alive[i] && t.breedEnergy > 0.f && prey.energy[i] > t.breedEnergy && prey.cooldown[i] <= 0.f;
+}
+void Sheep::resetReproduction(Population& prey, std::size_t i, const Config::StageTable& stages) {
+    const Config::StageTraits& t = stages[prey.level[i]];
+    prey.energy[i] -= t.breedCost; prey.cooldown[i] = t.breedCooldown;
 }
 
-bool Sheep::canReproduce() const { return alive && m_level >= 2 && energy > 70.f && m_reproCooldown <= 0.f; }
-void Sheep::resetReproduction() { energy -= 40.f; m_reproCooldown = 6.f; }
-void Sheep::draw(sf::RenderWindow& window) { shape.setPosition(pos); window.draw(shape); }
\ No newline at end of file
+// Noyaux instanciés pour chaque stade de proie de la table compilée et pour une table chargée
+template void Sheep::findDangers(const Population&, std::size_t, std::size_t, const PopulationSnapshot&, Dangers&, const Config::Builtin<Config::BACTERIA>&);
+template void Sheep::findDangers(const Population&, std::size_t, std::size_t, const PopulationSnapshot&, Dangers&, const Config::Builtin<Config::FISH>&);
+template void Sheep::findDangers(const Population&, std::size_t, std::size_t, const PopulationSnapshot&, Dangers&, const Config::Custom&);
+template std::optional<sf::Vector2f> Sheep::steer(const Population&, std::size_t, std::uint32_t, const PopulationSnapshot&, const std::optional<Food>&, const Config::Builtin<Config::BACTERIA>&);
+template std::optional<sf::Vector2f> Sheep::steer(const Population&, std::size_t, std::uint32_t, const PopulationSnapshot&, const std::optional<Food>&, const Config::Builtin<Config::FISH>&);
+template std::optional<sf::Vector2f> Sheep::steer(const Population&, std::size_t, std::uint32_t, const PopulationSnapshot&, const std::optional<Food>&, const Config::Custom&);
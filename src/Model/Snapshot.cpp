@@ -0,0 +1,226 @@
+/**
+ * @file Snapshot.cpp
+ * @author Sasha Marie te Rehorst (sasha.marieterehorst@gmail.com)
+ * @author Gael Guinaliu (rodez.gael@gmail.com)
+ * @brief Écriture et chargement (mmap) des sauvegardes binaires.
+ * @version 1.0
+ * @date 2026-01-18
+ */
+
+// AUCUN INCLUDE ICI (Géré par CMake)
+#include <cstring>    // std::memcpy, std::memcmp
+#include <filesystem> // rename atomique (remplace la cible sur toutes les plateformes)
+
+namespace {
+
+/**
+ * @struct FileHeader
+ * @brief En-tête fixe du fichier, suivi des colonnes (chacune complétée à 8 octets).
+ * @details Ordre des blocs : colonnes des proies, colonnes des requins, plantes
+ * (positions, états, liste libre), cellules du champ, état texte du générateur.
+ */
+struct FileHeader {
+    char magic[8];
+    std::uint32_t version;
+    std::uint32_t plantModel;
+    std::uint64_t prey, sharks, plantSlots, plantFree;
+    float bounds[4];
+    float simulationTime;
+    std::int32_t counters[4]; ///< Morts puis naissances (proies, requins).
+    std::uint32_t fieldCols, fieldRows, fieldTick;
+    std::uint32_t rngBytes;
+    std::uint32_t reserved;
+};
+
+static_assert(sizeof(FileHeader) == 104, "L'en-tete ne doit pas contenir de remplissage");
+
+} // namespace
+
+static constexpr char MAGIC[8] = {'S', 'P', 'O', 'R', 'E', '2', 'D', '\0'};
+
+static std::size_t padded(std::size_t bytes) { return (bytes + 7) & ~(std::size_t)7; }
+
+// -------------------------------------------------------------------------
+// ÉCRITURE
+// -------------------------------------------------------------------------
+
+static void writeBlock(std::ostream& out, const void* data, std::size_t bytes) {
+    static const char zeros[8] = {};
+    if (bytes) out.write(static_cast<const char*>(data), (std::streamsize)bytes);
+    out.write(zeros, (std::streamsize)(padded(bytes) - bytes));
+}
+
+template <typename T>
+static void writeColumn(std::ostream& out, const std::vector<T>& column) {
+    writeBlock(out, column.data(), column.size() * sizeof(T));
+}
+
+static void writePopulation(std::ostream& out, const Population& pop) {
+    writeColumn(out, pop.x); writeColumn(out, pop.y);
+    writeColumn(out, pop.energy); writeColumn(out, pop.radius);
+    writeColumn(out, pop.speed); writeColumn(out, pop.cooldown);
+    writeColumn(out, pop.level); writeColumn(out, pop.eaten);
+    writeColumn(out, pop.alive); writeColumn(out, pop.seed);
+}
+
+bool saveSnapshot(const std::string& path, const WorldState& state) {
+    std::ostringstream rngText;
+    rngText << state.rng;
+    std::string rng = rngText.str();
+
+    FileHeader header{};
+    std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+    header.version = WorldState::VERSION;
+    header.plantModel = (std::uint32_t)state.plantModel;
+    header.prey = state.prey.size();
+    header.sharks = state.sharks.size();
+    header.plantSlots = state.plantSlots.size();
+    header.plantFree = state.plantFree.size();
+    header.bounds[0] = state.xMin; header.bounds[1] = state.xMax;
+    header.bounds[2] = state.yMin; header.bounds[3] = state.yMax;
+    header.simulationTime = state.simulationTime;
+    header.counters[0] = state.deadPrey; header.counters[1] = state.deadSharks;
+    header.counters[2] = state.bornPrey; header.counters[3] = state.bornSharks;
+    header.fieldCols = state.fieldCols;
+    header.fieldRows = state.fieldRows;
+    header.fieldTick = state.fieldTick;
+    header.rngBytes = (std::uint32_t)rng.size();
+
+    std::string tmpPath = path + ".tmp";
+    {
+        std::ofstream out(tmpPath, std::ios::binary | std::ios::trunc);
+        if (!out) return false;
+        writeBlock(out, &header, sizeof(header));
+        writePopulation(out, state.prey);
+        writePopulation(out, state.sharks);
+
+        // Grass contient du remplissage : positions et états écrits en colonnes
+        std::vector<float> pos;
+        std::vector<std::uint8_t> alive;
+        pos.reserve(2 * state.plantSlots.size());
+        alive.reserve(state.plantSlots.size());
+        for (const Grass& g : state.plantSlots) {
+            pos.push_back(g.pos.x); pos.push_back(g.pos.y);
+            alive.push_back(g.alive ? 1 : 0);
+        }
+        writeColumn(out, pos);
+        writeColumn(out, alive);
+        writeColumn(out, state.plantFree);
+        writeColumn(out, state.fieldCells);
+        writeBlock(out, rng.data(), rng.size());
+        if (!out.flush()) return false;
+    }
+
+    std::error_code error;
+    std::filesystem::rename(tmpPath, path, error);
+    return !error;
+}
+
+// -------------------------------------------------------------------------
+// CHARGEMENT
+// -------------------------------------------------------------------------
+
+namespace {
+
+/**
+ * @class Reader
+ * @brief Curseur borné sur le fichier projeté : toute lecture hors du fichier échoue.
+ */
+class Reader {
+public:
+    Reader(const std::uint8_t* data, std::size_t size) : m_data(data), m_size(size) {}
+
+    /// Pointe sur le prochain bloc de @p bytes octets et avance (nullptr si le fichier est trop court).
+    const std::uint8_t* block(std::size_t bytes) {
+        if (bytes > m_size - m_offset || padded(bytes) > m_size - m_offset) return nullptr;
+        const std::uint8_t* p = m_data + m_offset;
+        m_offset += padded(bytes);
+        return p;
+    }
+
+    template <typename T>
+    bool column(std::vector<T>& dst, std::size_t n) {
+        if (n > m_size / sizeof(T)) return false;
+        const std::uint8_t* p = block(n * sizeof(T));
+        if (!p) return false;
+        dst.resize(n);
+        if (n) std::memcpy(dst.data(), p, n * sizeof(T));
+        return true;
+    }
+
+private:
+    const std::uint8_t* m_data;
+    std::size_t m_size;
+    std::size_t m_offset = 0;
+};
+
+} // namespace
+
+static bool readPopulation(Reader& in, Population& pop, std::size_t n, std::uint8_t firstLevel, std::uint8_t lastLevel) {
+    bool ok = in.column(pop.x, n) && in.column(pop.y, n)
+           && in.column(pop.energy, n) && in.column(pop.radius, n)
+           && in.column(pop.speed, n) && in.column(pop.cooldown, n)
+           && in.column(pop.level, n) && in.column(pop.eaten, n)
+           && in.column(pop.alive, n) && in.column(pop.seed, n);
+    if (!ok) return false;
+    // Le stade indexe les tables de traits, la position les grilles : un fichier abîmé
+    // ne doit pas les faire lire hors de leurs bornes (les trous gardent un stade valide).
+    // Un vivant a un stade de sa population : les boucles par stade ne traitent que ceux-là.
+    for (std::size_t i = 0; i < n; ++i) {
+        if (pop.level[i] == 0 || pop.level[i] >= Config::STAGE_COUNT) return false;
+        if (pop.alive[i] && (pop.level[i] < firstLevel || pop.level[i] > lastLevel)) return false;
+        if (!std::isfinite(pop.x[i]) || !std::isfinite(pop.y[i])) return false;
+    }
+    pop.indexCell.assign(n, NOT_INDEXED);
+    return true;
+}
+
+bool loadSnapshot(const std::string& path, WorldState& state) {
+    MappedFile file;
+    if (!file.open(path)) return false;
+    Reader in(file.data(), file.size());
+
+    FileHeader header;
+    const std::uint8_t* p = in.block(sizeof(header));
+    if (!p) return false;
+    std::memcpy(&header, p, sizeof(header));
+    if (std::memcmp(header.magic, MAGIC, sizeof(MAGIC)) != 0 || header.version != WorldState::VERSION) return false;
+    if (header.plantModel > (std::uint32_t)PlantModel::Field) return false;
+    for (float bound : header.bounds) if (!std::isfinite(bound)) return false;
+    if (!(header.bounds[0] < header.bounds[1] && header.bounds[2] < header.bounds[3])) return false;
+
+    state.plantModel = (PlantModel)header.plantModel;
+    state.xMin = header.bounds[0]; state.xMax = header.bounds[1];
+    state.yMin = header.bounds[2]; state.yMax = header.bounds[3];
+    state.simulationTime = header.simulationTime;
+    state.deadPrey = header.counters[0]; state.deadSharks = header.counters[1];
+    state.bornPrey = header.counters[2]; state.bornSharks = header.counters[3];
+    state.fieldCols = header.fieldCols;
+    state.fieldRows = header.fieldRows;
+    state.fieldTick = header.fieldTick;
+
+    if (!readPopulation(in, state.prey, header.prey, Config::BACTERIA, Config::FISH) ||
+        !readPopulation(in, state.sharks, header.sharks, Config::SHARK, Config::SHARK)) return false;
+
+    std::vector<float> pos;
+    std::vector<std::uint8_t> alive;
+    if (!in.column(pos, 2 * header.plantSlots) || !in.column(alive, header.plantSlots)) return false;
+    state.plantSlots.clear();
+    state.plantSlots.reserve(header.plantSlots);
+    for (std::size_t k = 0; k < header.plantSlots; ++k) {
+        // Même règle que les agents : la position indexe la grille des plantes
+        if (!std::isfinite(pos[2 * k]) || !std::isfinite(pos[2 * k + 1])) return false;
+        state.plantSlots.emplace_back(sf::Vector2f(pos[2 * k], pos[2 * k + 1]));
+        state.plantSlots.back().alive = alive[k] != 0;
+    }
+    if (!in.column(state.plantFree, header.plantFree)) return false;
+    for (PlantStore::Id id : state.plantFree)
+        if (id >= header.plantSlots || state.plantSlots[id].alive) return false;
+
+    if (!in.column(state.fieldCells, (std::size_t)header.fieldCols * header.fieldRows)) return false;
+
+    const std::uint8_t* rng = in.block(header.rngBytes);
+    if (!rng) return false;
+    std::istringstream rngText(std::string(reinterpret_cast<const char*>(rng), header.rngBytes));
+    return (bool)(rngText >> state.rng);
+}
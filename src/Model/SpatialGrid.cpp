@@ -0,0 +1,28 @@
+/**
+ * @file SpatialGrid.cpp
+ * @author Sasha Marie te Rehorst (sasha.marieterehorst@gmail.com)
+ * @author Gael Guinaliu (rodez.gael@gmail.com)
+ * @brief Dimensionnement de la grille uniforme.
+ * @version 1.0
+ * @date 2026-01-08
+ */
+
+// AUCUN INCLUDE ICI (Géré par CMake)
+
+void SpatialGrid::setup(float xMin, float xMax, float yMin, float yMax, float cellSize, std::size_t count) {
+    // La tolérance des murs (Motion::WALL_KILL) laisse les entités déborder un peu du monde :
+    // on les range dans les cellules du bord (clamp), donc pas besoin d'agrandir la grille.
+    float width = std::max(1.f, xMax - xMin);
+    float height = std::max(1.f, yMax - yMin);
+
+    // Au plus ~4 cellules par corps : au-delà, on agrandit les cellules.
+    float minCellForMemory = std::sqrt((width * height) / (4.f * (float)std::max<std::size_t>(count, 1)));
+    m_cellSize = std::max({cellSize, minCellForMemory, 1.f});
+    m_invCell = 1.f / m_cellSize;
+
+    m_xMin = xMin; m_yMin = yMin;
+    m_cols = std::max(1, (int)std::ceil(width * m_invCell));
+    m_rows = std::max(1, (int)std::ceil(height * m_invCell));
+    m_cellCount = (std::size_t)m_cols * (std::size_t)m_rows;
+    m_cellStart.resize(m_cellCount + 1);
+}
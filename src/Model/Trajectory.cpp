@@ -0,0 +1,606 @@
+/**
+ * @file Trajectory.cpp
+ * @author Sasha Marie te Rehorst (sasha.marieterehorst@gmail.com)
+ * @author Gael Guinaliu (rodez.gael@gmail.com)
+ * @brief Codage des images (écarts quantifiés, événements) et relecture.
+ * @details Fichier : en-tête de 16 octets, puis les images les unes après les autres,
+ * chacune faite d'un FrameHeader et de sa charge utile.
+ *
+ * Image clé : limites du monde, modèle de plantes, puis pour chaque espèce le nombre
+ * d'agents et, par agent, x et y absolus, stade et rayon ; enfin les plantes (emplacements
+ * vivants et positions, ou cellules du champ compressées par plages).
+ *
+ * Image d'écart, par espèce : indices retirés (dans l'image précédente), changements de
+ * stade, nombre de naissances (et, pour les requins, combien viennent d'un poisson),
+ * puis l'écart de position de chaque survivant et la description complète des nouveaux-nés.
+ * Plantes : emplacements retirés puis ajoutés, ou cellules du champ modifiées.
+ * @version 1.0
+ * @date 2026-01-20
+ */
+
+// AUCUN INCLUDE ICI (Géré par CMake)
+#include <cstring> // std::memcpy, std::memcmp
+
+namespace {
+
+constexpr char MAGIC[8] = {'S', 'P', '2', 'D', 'T', 'R', 'A', 'J'};
+constexpr std::size_t FILE_HEADER_BYTES = 16; ///< Magique, version, réservé.
+
+constexpr std::uint32_t FLAG_KEY = 1;
+
+/**
+ * @struct FrameHeader
+ * @brief En-tête d'image : taille de la charge utile et statistiques affichées par le HUD.
+ */
+struct FrameHeader {
+    std::uint32_t payloadBytes;
+    std::uint32_t flags;
+    std::int32_t stats[9]; ///< EcosystemStats dans l'ordre de Stats.hpp (sans le temps).
+    float simulationTime;
+};
+
+static_assert(sizeof(FrameHeader) == 48, "L'en-tete d'image ne doit pas contenir de remplissage");
+
+// -------------------------------------------------------------------------
+// CODAGE
+// -------------------------------------------------------------------------
+
+std::int32_t quantize(float v) { return (std::int32_t)std::lround(v * Trajectory::SCALE); }
+std::uint8_t quantizeRadius(float r) { return (std::uint8_t)std::clamp(std::lround(r * 4.f), 0L, 255L); }
+
+void putVarint(std::vector<std::uint8_t>& out, std::uint32_t v) {
+    while (v >= 0x80) { out.push_back((std::uint8_t)(v | 0x80)); v >>= 7; }
+    out.push_back((std::uint8_t)v);
+}
+
+// Zigzag : les petits écarts négatifs restent courts (-1 -> 1, 1 -> 2...)
+void putSigned(std::vector<std::uint8_t>& out, std::int32_t v) {
+    putVarint(out, ((std::uint32_t)v << 1) ^ (std::uint32_t)(v >> 31));
+}
+
+void putRaw(std::vector<std::uint8_t>& out, const void* data, std::size_t bytes) {
+    const std::uint8_t* p = static_cast<const std::uint8_t*>(data);
+    out.insert(out.end(), p, p + bytes);
+}
+
+/**
+ * @class Cursor
+ * @brief Lecture bornée d'une charge utile : un dépassement marque l'image comme corrompue.
+ */
+class Cursor {
+public:
+    Cursor(const std::uint8_t* p, const std::uint8_t* end) : m_p(p), m_end(end) {}
+
+    std::uint32_t varint() {
+        std::uint32_t v = 0;
+        for (int shift = 0; shift < 35; shift += 7) {
+            if (m_p == m_end) { m_ok = false; return 0; }
+            std::uint8_t b = *m_p++;
+            v |= (std::uint32_t)(b & 0x7F) << shift;
+            if (!(b & 0x80)) return v;
+        }
+        m_ok = false;
+        return 0;
+    }
+
+    std::int32_t signedVarint() {
+        std::uint32_t z = varint();
+        return (std::int32_t)((z >> 1) ^ (0u - (z & 1)));
+    }
+
+    std::uint8_t byte() {
+        if (m_p == m_end) { m_ok = false; return 0; }
+        return *m_p++;
+    }
+
+    void raw(void* dst, std::size_t bytes) {
+        if ((std::size_t)(m_end - m_p) < bytes) { m_ok = false; return; }
+        std::memcpy(dst, m_p, bytes);
+        m_p += bytes;
+    }
+
+    /// Nombre d'éléments annoncé, plausible seulement s'il reste au moins @p minBytes octets par élément.
+    std::uint32_t count(std::size_t minBytes) {
+        std::uint32_t n = varint();
+        if ((std::size_t)n * minBytes > (std::size_t)(m_end - m_p)) { m_ok = false; return 0; }
+        return n;
+    }
+
+    bool ok() const { return m_ok; }
+    bool atEnd() const { return m_p == m_end; }
+
+private:
+    const std::uint8_t* m_p;
+    const std::uint8_t* m_end;
+    bool m_ok = true;
+};
+
+/// Indices des entités vivantes de @p pop, dans l'ordre des colonnes (les trous sont sautés).
+void gatherLive(const Population& pop, std::vector<std::uint32_t>& live) {
+    live.clear();
+    for (std::uint32_t i = 0; i < pop.size(); ++i)
+        if (pop.alive[i]) live.push_back(i);
+}
+
+/// Nombre d'indices de @p removed (croissants) inférieurs à @p n.
+std::size_t removedBefore(const std::vector<std::uint32_t>& removed, std::size_t n) {
+    return (std::size_t)(std::lower_bound(removed.begin(), removed.end(), (std::uint32_t)n) - removed.begin());
+}
+
+} // namespace
+
+// -------------------------------------------------------------------------
+// ENREGISTREMENT
+// -------------------------------------------------------------------------
+
+bool TrajectoryRecorder::open(const std::string& path) {
+    close();
+    m_out.open(path, std::ios::binary | std::ios::trunc);
+    if (!m_out) return false;
+
+    std::uint8_t header[FILE_HEADER_BYTES] = {};
+    std::memcpy(header, MAGIC, sizeof(MAGIC));
+    std::uint32_t version = Trajectory::VERSION;
+    std::memcpy(header + 8, &version, sizeof(version));
+    m_out.write(reinterpret_cast<const char*>(header), sizeof(header));
+
+    m_frames = 0;
+    m_bytes = sizeof(header);
+    return (bool)m_out;
+}
+
+void TrajectoryRecorder::close() {
+    if (m_out.is_open()) m_out.close();
+}
+
+void TrajectoryRecorder::record(const World& world) {
+    if (!m_out.is_open()) return;
+    PROFILE_SCOPE("enregistrement");
+
+    gatherLive(world.getPrey(), m_livePrey);
+    gatherLive(world.getSharks(), m_liveSharks);
+    const PlantField& field = world.getPlantField();
+    float bounds[4] = {world.getBoundsMin().x, world.getBoundsMax().x, world.getBoundsMin().y, world.getBoundsMax().y};
+
+    // Un écart n'a de sens que par rapport à l'image du pas précédent, dans le même monde
+    bool key = m_frames == 0 || m_sinceKey + 1 >= Trajectory::KEYFRAME_INTERVAL
+            || world.epoch() != m_epoch || world.stepCount() != m_step + 1
+            || std::memcmp(bounds, m_bounds, sizeof(bounds)) != 0 || world.plantModel() != m_plantModel
+            || (m_plantModel == PlantModel::Field && (field.cols() != m_fieldCols || field.rows() != m_fieldRows))
+            || m_livePrey.size() < m_prey.size() - removedBefore(world.removedPrey(), m_prey.size())
+            || m_liveSharks.size() < m_sharks.size() - removedBefore(world.removedSharks(), m_sharks.size());
+
+    m_payload.clear();
+    std::memcpy(m_bounds, bounds, sizeof(bounds));
+    m_plantModel = world.plantModel();
+    if (key) encodeKey(world);
+    else encodeDelta(world);
+    m_sinceKey = key ? 0 : m_sinceKey + 1;
+    m_epoch = world.epoch();
+    m_step = world.stepCount();
+
+    EcosystemStats s = world.getStats();
+    FrameHeader header{};
+    header.payloadBytes = (std::uint32_t)m_payload.size();
+    header.flags = key ? FLAG_KEY : 0;
+    std::int32_t stats[9] = {s.plants, s.preyTotal, s.bacteria, s.fish, s.sharks,
+                             s.deadPrey, s.deadSharks, s.bornPrey, s.bornSharks};
+    std::memcpy(header.stats, stats, sizeof(stats));
+    header.simulationTime = s.simulationTime;
+
+    m_out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    m_out.write(reinterpret_cast<const char*>(m_payload.data()), (std::streamsize)m_payload.size());
+    m_frames++;
+    m_bytes += sizeof(header) + m_payload.size();
+}
+
+void TrajectoryRecorder::encodeKey(const World& world) {
+    putRaw(m_payload, m_bounds, sizeof(m_bounds));
+    m_payload.push_back((std::uint8_t)m_plantModel);
+
+    auto encodePopulation = [&](const Population& pop, const std::vector<std::uint32_t>& live, Trajectory::Track& track) {
+        track.clear();
+        putVarint(m_payload, (std::uint32_t)live.size());
+        for (std::uint32_t i : live) {
+            track.qx.push_back(quantize(pop.x[i]));
+            track.qy.push_back(quantize(pop.y[i]));
+            track.level.push_back(pop.level[i]);
+            track.radius.push_back(quantizeRadius(pop.radius[i]));
+            putSigned(m_payload, track.qx.back());
+            putSigned(m_payload, track.qy.back());
+            m_payload.push_back(track.level.back());
+            m_payload.push_back(track.radius.back());
+        }
+    };
+    encodePopulation(world.getPrey(), m_livePrey, m_prey);
+    encodePopulation(world.getSharks(), m_liveSharks, m_sharks);
+
+    if (m_plantModel == PlantModel::Field) {
+        const PlantField& field = world.getPlantField();
+        m_fieldCols = field.cols();
+        m_fieldRows = field.rows();
+        putVarint(m_payload, (std::uint32_t)m_fieldCols);
+        putVarint(m_payload, (std::uint32_t)m_fieldRows);
+        sf::Vector2f origin = field.origin();
+        float cellSize = field.cellSize();
+        putRaw(m_payload, &origin.x, sizeof(float));
+        putRaw(m_payload, &origin.y, sizeof(float));
+        putRaw(m_payload, &cellSize, sizeof(float));
+
+        // Plages de cellules identiques : un champ est fait de grandes zones vides ou pleines
+        m_cells = field.cells();
+        for (std::size_t c = 0; c < m_cells.size();) {
+            std::size_t run = 1;
+            while (c + run < m_cells.size() && m_cells[c + run] == m_cells[c]) run++;
+            m_payload.push_back(m_cells[c]);
+            putVarint(m_payload, (std::uint32_t)run);
+            c += run;
+        }
+        m_plants.clear();
+    } else {
+        const std::vector<Grass>& slots = world.getPlants().slots();
+        putVarint(m_payload, (std::uint32_t)slots.size());
+        putVarint(m_payload, (std::uint32_t)world.getPlants().size());
+        std::uint32_t next = 0;
+        for (std::uint32_t i = 0; i < slots.size(); ++i) {
+            if (!slots[i].alive) continue;
+            putVarint(m_payload, i - next);
+            putSigned(m_payload, quantize(slots[i].pos.x));
+            putSigned(m_payload, quantize(slots[i].pos.y));
+            next = i + 1;
+        }
+        m_plants = slots;
+        m_cells.clear();
+    }
+}
+
+void TrajectoryRecorder::encodeAgents(const Population& pop, const std::vector<std::uint32_t>& live, Trajectory::Track& track,
+                                      const std::vector<std::uint32_t>& removed, std::size_t evolved, bool withEvolved) {
+    // 1. Retraits : indices de l'image précédente (les agents nés et morts entre deux images n'y figurent pas)
+    std::size_t n = track.size();
+    std::size_t removedCount = removedBefore(removed, n);
+    putVarint(m_payload, (std::uint32_t)removedCount);
+    std::uint32_t next = 0;
+    std::size_t kept = 0, r = 0;
+    for (std::size_t i = 0; i < n; ++i) {
+        if (r < removedCount && removed[r] == i) {
+            putVarint(m_payload, (std::uint32_t)i - next);
+            next = (std::uint32_t)i + 1;
+            r++;
+            continue;
+        }
+        track.qx[kept] = track.qx[i]; track.qy[kept] = track.qy[i];
+        track.level[kept] = track.level[i]; track.radius[kept] = track.radius[i];
+        kept++;
+    }
+    track.qx.resize(kept); track.qy.resize(kept);
+    track.level.resize(kept); track.radius.resize(kept);
+
+    // 2. Changements de stade des survivants (les vivantes gardent leur ordre d'une image à l'autre)
+    std::uint32_t changes = 0;
+    for (std::size_t k = 0; k < kept; ++k)
+        if (pop.level[live[k]] != track.level[k] || quantizeRadius(pop.radius[live[k]]) != track.radius[k]) changes++;
+    putVarint(m_payload, changes);
+    next = 0;
+    for (std::uint32_t k = 0; k < kept && changes; ++k) {
+        std::uint32_t i = live[k];
+        std::uint8_t radius = quantizeRadius(pop.radius[i]);
+        if (pop.level[i] == track.level[k] && radius == track.radius[k]) continue;
+        putVarint(m_payload, k - next);
+        m_payload.push_back(pop.level[i]);
+        m_payload.push_back(radius);
+        track.level[k] = pop.level[i];
+        track.radius[k] = radius;
+        next = k + 1;
+        changes--;
+    }
+
+    // 3. Naissances (les requins issus d'un poisson sont les derniers ajoutés)
+    std::size_t births = live.size() - kept;
+    putVarint(m_payload, (std::uint32_t)births);
+    if (withEvolved) putVarint(m_payload, (std::uint32_t)std::min(evolved, births));
+
+    // 4. Déplacements des survivants, puis nouveaux-nés en absolu
+    for (std::size_t k = 0; k < kept; ++k) {
+        std::int32_t qx = quantize(pop.x[live[k]]), qy = quantize(pop.y[live[k]]);
+        putSigned(m_payload, qx - track.qx[k]);
+        putSigned(m_payload, qy - track.qy[k]);
+        track.qx[k] = qx; track.qy[k] = qy;
+    }
+    for (std::size_t b = kept; b < live.size(); ++b) {
+        std::uint32_t i = live[b];
+        track.qx.push_back(quantize(pop.x[i]));
+        track.qy.push_back(quantize(pop.y[i]));
+        track.level.push_back(pop.level[i]);
+        track.radius.push_back(quantizeRadius(pop.radius[i]));
+        putSigned(m_payload, track.qx.back());
+        putSigned(m_payload, track.qy.back());
+        m_payload.push_back(track.level.back());
+        m_payload.push_back(track.radius.back());
+    }
+}
+
+void TrajectoryRecorder::encodePlantsDelta(const World& world) {
+    if (m_plantModel == PlantModel::Field) {
+        const std::vector<std::uint8_t>& cells = world.getPlantField().cells();
+        std::uint32_t changed = 0;
+        for (std::size_t c = 0; c < cells.size(); ++c) changed += cells[c] != m_cells[c];
+        putVarint(m_payload, changed);
+        std::uint32_t next = 0;
+        for (std::uint32_t c = 0; c < cells.size() && changed; ++c) {
+            if (cells[c] == m_cells[c]) continue;
+            putVarint(m_payload, c - next);
+            m_payload.push_back(cells[c]);
+            m_cells[c] = cells[c];
+            next = c + 1;
+            changed--;
+        }
+        return;
+    }
+
+    // Emplacement retiré puis réattribué entre deux images : un retrait et un ajout
+    const std::vector<Grass>& slots = world.getPlants().slots();
+    auto same = [&](std::size_t i) {
+        return i < slots.size() && i < m_plants.size() && slots[i].alive && m_plants[i].alive && slots[i].pos == m_plants[i].pos;
+    };
+    auto emit = [&](const std::vector<Grass>& from, bool withPos) {
+        std::uint32_t count = 0;
+        for (std::size_t i = 0; i < from.size(); ++i) count += from[i].alive && !same(i);
+        putVarint(m_payload, count);
+        std::uint32_t next = 0;
+        for (std::uint32_t i = 0; i < from.size() && count; ++i) {
+            if (!from[i].alive || same(i)) continue;
+            putVarint(m_payload, i - next);
+            if (withPos) {
+                putSigned(m_payload, quantize(from[i].pos.x));
+                putSigned(m_payload, quantize(from[i].pos.y));
+            }
+            next = i + 1;
+            count--;
+        }
+    };
+    emit(m_plants, false); // Retraits
+    emit(slots, true);     // Ajouts
+    m_plants = slots;
+}
+
+void TrajectoryRecorder::encodeDelta(const World& world) {
+    encodeAgents(world.getPrey(), m_livePrey, m_prey, world.removedPrey(), 0, false);
+    encodeAgents(world.getSharks(), m_liveSharks, m_sharks, world.removedSharks(), world.evolvedSharks(), true);
+    encodePlantsDelta(world);
+}
+
+// -------------------------------------------------------------------------
+// RELECTURE
+// -------------------------------------------------------------------------
+
+bool TrajectoryPlayer::open(const std::string& path) {
+    m_frames.clear();
+    m_keys.clear();
+    m_decoded = false;
+    m_position = 0;
+    if (!m_file.open(path, false)) return false;
+
+    const std::uint8_t* data = m_file.data();
+    std::size_t size = m_file.size();
+    std::uint32_t version = 0;
+    if (size < FILE_HEADER_BYTES || std::memcmp(data, MAGIC, sizeof(MAGIC)) != 0) return false;
+    std::memcpy(&version, data + 8, sizeof(version));
+    if (version != Trajectory::VERSION) return false;
+
+    // Table des images : seuls les en-têtes sont lus. Une image tronquée (arrêt pendant
+    // l'enregistrement) termine la table.
+    for (std::size_t offset = FILE_HEADER_BYTES; size - offset >= sizeof(FrameHeader);) {
+        FrameHeader header;
+        std::memcpy(&header, data + offset, sizeof(header));
+        if (header.payloadBytes > size - offset - sizeof(header)) break;
+        bool key = header.flags & FLAG_KEY;
+        if (key) m_keys.push_back(m_frames.size());
+        m_frames.push_back({offset, key});
+        offset += sizeof(header) + header.payloadBytes;
+    }
+    if (m_keys.empty() || m_keys.front() != 0) { m_frames.clear(); m_keys.clear(); return false; }
+    return seek(0);
+}
+
+bool TrajectoryPlayer::seek(std::size_t frame, bool exact) {
+    if (m_frames.empty()) return false;
+    std::size_t target = std::min(frame, m_frames.size() - 1);
+    std::size_t key = *(std::upper_bound(m_keys.begin(), m_keys.end(), target) - 1);
+    if (!exact) target = key;
+
+    // Déjà entre l'image clé et la cible : on avance depuis l'image courante
+    std::size_t start = key;
+    if (m_decoded && m_position >= key && m_position <= target) {
+        if (!exact || m_position == target) return true;
+        start = m_position + 1;
+    }
+    for (std::size_t f = start; f <= target; ++f) {
+        if (decode(f)) continue;
+        // Image corrompue : les pistes sont à moitié modifiées, on redécode la dernière image valide
+        std::size_t valid = m_position;
+        std::size_t from = *(std::upper_bound(m_keys.begin(), m_keys.end(), valid) - 1);
+        for (std::size_t g = from; g <= valid && decode(g); ++g) {}
+        return false;
+    }
+    return true;
+}
+
+bool TrajectoryPlayer::decode(std::size_t frame) {
+    const std::uint8_t* base = m_file.data() + m_frames[frame].offset;
+    FrameHeader header;
+    std::memcpy(&header, base, sizeof(header));
+    Cursor in(base + sizeof(header), base + sizeof(header) + header.payloadBytes);
+    bool key = header.flags & FLAG_KEY;
+    if (!key && !(m_decoded && m_position + 1 == frame)) return false;
+
+    // Tout échec à partir d'ici laisse des pistes incohérentes : plus rien de décodé tant que
+    // l'image n'est pas lue jusqu'au bout
+    m_decoded = false;
+    m_viewDirty = true;
+    m_events = {};
+    auto readAgent = [&](Trajectory::Track& track) {
+        track.qx.push_back(in.signedVarint());
+        track.qy.push_back(in.signedVarint());
+        track.level.push_back(in.byte());
+        track.radius.push_back(in.byte());
+    };
+
+    if (key) {
+        in.raw(m_bounds, sizeof(m_bounds));
+        std::uint8_t model = in.byte();
+        if (model > (std::uint8_t)PlantModel::Field) return false;
+        m_plantModel = (PlantModel)model;
+        for (Trajectory::Track* track : {&m_prey, &m_sharks}) {
+            track->clear();
+            std::uint32_t n = in.count(4);
+            for (std::uint32_t i = 0; i < n && in.ok(); ++i) readAgent(*track);
+        }
+
+        m_plants.clear();
+        if (m_plantModel == PlantModel::Field) {
+            std::uint32_t cols = in.varint(), rows = in.varint();
+            float origin[2], cellSize;
+            in.raw(origin, sizeof(origin));
+            in.raw(&cellSize, sizeof(cellSize));
+            if (!in.ok() || (std::size_t)cols * rows > ((std::size_t)1 << 32)) return false;
+            m_field.reset(origin[0], origin[0] + cols * cellSize, origin[1], origin[1] + rows * cellSize, cellSize);
+            m_cells.assign((std::size_t)cols * rows, 0);
+            for (std::size_t c = 0; c < m_cells.size() && in.ok();) {
+                std::uint8_t value = in.byte();
+                std::uint32_t run = in.varint();
+                if (run == 0 || run > m_cells.size() - c) return false;
+                std::fill_n(m_cells.begin() + c, run, value);
+                c += run;
+            }
+            if (!in.ok() || !m_field.assign(m_cells, 0)) return false;
+        } else {
+            std::uint32_t slots = in.varint(), alive = in.count(3);
+            m_plants.assign(slots, Grass({0.f, 0.f}));
+            for (Grass& g : m_plants) g.alive = false;
+            std::uint32_t next = 0;
+            for (std::uint32_t k = 0; k < alive && in.ok(); ++k) {
+                std::uint32_t i = next + in.varint();
+                float x = in.signedVarint() / Trajectory::SCALE, y = in.signedVarint() / Trajectory::SCALE;
+                if (i >= slots) return false;
+                m_plants[i] = Grass({x, y});
+                next = i + 1;
+            }
+        }
+    } else {
+        auto decodeAgents = [&](Trajectory::Track& track, bool withEvolved, std::uint32_t& born, std::uint32_t& died) {
+            // Retraits
+            std::size_t n = track.size();
+            std::uint32_t removed = in.count(1);
+            m_keep.assign(n, 1);
+            std::uint32_t next = 0;
+            for (std::uint32_t k = 0; k < removed && in.ok(); ++k) {
+                std::uint32_t i = next + in.varint();
+                if (i >= n) return false;
+                m_keep[i] = 0;
+                next = i + 1;
+            }
+            std::size_t kept = 0;
+            for (std::size_t i = 0; i < n; ++i) {
+                if (!m_keep[i]) continue;
+                track.qx[kept] = track.qx[i]; track.qy[kept] = track.qy[i];
+                track.level[kept] = track.level[i]; track.radius[kept] = track.radius[i];
+                kept++;
+            }
+            track.qx.resize(kept); track.qy.resize(kept);
+            track.level.resize(kept); track.radius.resize(kept);
+            died = removed;
+
+            // Changements de stade
+            std::uint32_t changes = in.count(3);
+            next = 0;
+            for (std::uint32_t k = 0; k < changes && in.ok(); ++k) {
+                std::uint32_t i = next + in.varint();
+                if (i >= kept) return false;
+                track.level[i] = in.byte();
+                track.radius[i] = in.byte();
+                next = i + 1;
+            }
+            m_events.evolutions += withEvolved ? 0 : changes;
+
+            // Naissances, puis déplacements
+            born = in.count(4);
+            if (withEvolved) m_events.sharksEvolved = std::min(in.varint(), born);
+            for (std::size_t k = 0; k < kept && in.ok(); ++k) {
+                track.qx[k] += in.signedVarint();
+                track.qy[k] += in.signedVarint();
+            }
+            for (std::uint32_t k = 0; k < born && in.ok(); ++k) readAgent(track);
+            return in.ok();
+        };
+        if (!decodeAgents(m_prey, false, m_events.preyBorn, m_events.preyDied)) return false;
+        if (!decodeAgents(m_sharks, true, m_events.sharksBorn, m_events.sharksDied)) return false;
+
+        if (m_plantModel == PlantModel::Field) {
+            std::uint32_t changed = in.count(2), next = 0;
+            for (std::uint32_t k = 0; k < changed && in.ok(); ++k) {
+                std::uint32_t c = next + in.varint();
+                std::uint8_t value = in.byte();
+                if (c >= m_cells.size()) return false;
+                m_cells[c] = value;
+                m_field.set(c, value);
+                next = c + 1;
+            }
+        } else {
+            std::uint32_t removed = in.count(1), next = 0;
+            for (std::uint32_t k = 0; k < removed && in.ok(); ++k) {
+                std::uint32_t i = next + in.varint();
+                if (i >= m_plants.size()) return false;
+                m_plants[i].alive = false;
+                next = i + 1;
+            }
+            std::uint32_t added = in.count(3);
+            std::size_t limit = m_plants.size() + added;
+            next = 0;
+            for (std::uint32_t k = 0; k < added && in.ok(); ++k) {
+                std::uint32_t i = next + in.varint();
+                float x = in.signedVarint() / Trajectory::SCALE, y = in.signedVarint() / Trajectory::SCALE;
+                if (i >= m_plants.size()) {
+                    if (i >= limit) return false; // Nouveaux emplacements : au plus un par ajout
+                    Grass empty({0.f, 0.f});
+                    empty.alive = false;
+                    m_plants.resize(i + 1, empty);
+                }
+                m_plants[i] = Grass({x, y});
+                next = i + 1;
+            }
+        }
+    }
+    if (!in.ok() || !in.atEnd()) return false;
+
+    EcosystemStats& s = m_stats;
+    s.plants = header.stats[0]; s.preyTotal = header.stats[1];
+    s.bacteria = header.stats[2]; s.fish = header.stats[3]; s.sharks = header.stats[4];
+    s.deadPrey = header.stats[5]; s.deadSharks = header.stats[6];
+    s.bornPrey = header.stats[7]; s.bornSharks = header.stats[8];
+    s.simulationTime = header.simulationTime;
+
+    m_position = frame;
+    m_decoded = true;
+    m_viewDirty = true;
+    return true;
+}
+
+void TrajectoryPlayer::materialize() {
+    if (!m_viewDirty) return;
+    m_viewDirty = false;
+    auto fill = [](const Trajectory::Track& track, Population& view) {
+        std::size_t n = track.size();
+        view.truncate(n);
+        const float inv = 1.f / Trajectory::SCALE;
+        for (std::size_t i = 0; i < n; ++i) {
+            view.x[i] = track.qx[i] * inv;
+            view.y[i] = track.qy[i] * inv;
+            view.radius[i] = track.radius[i] * 0.25f;
+            view.level[i] = track.level[i];
+            view.alive[i] = 1;
+        }
+    };
+    fill(m_prey, m_preyView);
+    fill(m_sharks, m_sharksView);
+}
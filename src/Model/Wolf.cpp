@@ -5,52 +5,54 @@
 
 // AUCUN INCLUDE ICI
 
-Wolf::Wolf(sf::Vector2f position) 
-    : Entity(position, 150.f, sf::Color(100, 100, 120), 12.f) // Gris requin
-{
-    shape.setOutlineThickness(2); shape.setOutlineColor(sf::Color::Black);
-    speed = 100.f; energy = 80.f; m_reproCooldown = 8.0f;
+std::size_t Wolf::spawn(Population& sharks, sf::Vector2f position, std::uint8_t wanderSeed, const Config::StageTable& stages) {
+    // Gris requin, gros et rapide
+    const Config::StageTraits& t = stages[Config::SHARK];
+    return sharks.add(position, t.birthEnergy, t.radius, t.speed, t.birthCooldown, Config::SHARK, wanderSeed);
 }
 
-void Wolf::update(float dt) {
-    if (!alive) return;
-    energy -= 4.0f * dt; // Le requin se fatigue vite
-    if (energy <= 0) alive = false;
-    if (m_reproCooldown > 0) m_reproCooldown -= dt;
+template <typename Traits>
+std::optional<sf::Vector2f> Wolf::steer(const Population& sharks, std::size_t i, const PopulationSnapshot& prey,
+                                        const FishIndex& fish, const Traits& traits) {
+    sf::Vector2f pos = sharks.pos(i);
+
+    // L'index ne contient que les poissons adultes : distances au carré, une seule racine à la fin.
+    // Synchronisé en fin de pas précédent, il ne contient que des poissons vivants dans le cliché :
+    // pas de filtre, la recherche passe par le noyau vectorisé.
+    float minSq = 0.f;
+    auto target = fish.nearest(pos, traits.stage(Config::SHARK).foodRange, &minSq);
+    if (!target) return std::nullopt; // Errance
+
+    float minDist = std::sqrt(minSq);
+    if (minDist > 0.1f) return (prey.pos(target->id) - pos) / minDist;
+    return sf::Vector2f(0.f, 0.f);
 }
 
-void Wolf::moveAI(float dt, const std::vector<Sheep>& prey, float simTime) {
-    if (!alive) return;
-    const Sheep* target = nullptr; float minDist = 500.f;
-    for (const auto& s : prey) {
-        if (s.alive && s.getLevel() == 2) { // Ne chasse que les poissons adultes
-            float d = dist(s.pos);
-            if (d < minDist) { minDist = d; target = &s; }
-        }
-    }
-    sf::Vector2f moveDir(0.f, 0.f);
-    if (target) {
-        sf::Vector2f diff = target->pos - pos;
-        if (minDist > 0.1f) moveDir = diff / minDist;
-    } else {
-        long long seed = (long long)this % 100;
-        float angle = std::sin(simTime * 0.3f + seed) * 6.28f;
-        moveDir = {std::cos(angle), std::sin(angle)};
-    }
-    pos += moveDir * speed * dt;
+template <typename Traits>
+std::uint32_t Wolf::findPrey(const Population& sharks, std::size_t i, const PopulationSnapshot& prey, const FishIndex& fish,
+                             const Traits& traits) {
+    if (!sharks.alive[i]) return NO_PREY;
+    auto e = fish.firstWithin(sharks.pos(i), traits.stage(Config::SHARK).biteRange,
+                              [&](std::uint32_t p) { return prey.alive[p] != 0; });
+    return e ? e->id : NO_PREY;
 }
 
-void Wolf::eat(std::vector<Sheep>& prey) {
-    if (!alive) return;
-    for (auto& s : prey) {
-        if (s.alive && s.getLevel() == 2 && dist(s.pos) < 25.f) {
-            s.alive = false; energy += 60.f;
-            if (energy > maxEnergy) energy = maxEnergy;
-            break;
-        }
-    }
+void Wolf::eat(Population& sharks, std::size_t i, const Config::StageTable& stages) {
+    const Config::StageTraits& t = stages[Config::SHARK];
+    sharks.energy[i] = std::min(sharks.energy[i] + t.mealEnergy, t.maxEnergy);
+}
+
+bool Wolf::canReproduce(const Population& sharks, std::size_t i, const Config::StageTable& stages) {
+    const Config::StageTraits& t = stages[Config::SHARK];
+    return sharks.alive[i] && t.breedEnergy > 0.f && sharks.energy[i] > t.breedEnergy && sharks.cooldown[i] <= 0.f;
+}
+void Wolf::resetReproduction(Population& sharks, std::size_t i, const Config::StageTable& stages) {
+    const Config::StageTraits& t = stages[Config::SHARK];
+    sharks.energy[i] -= t.breedCost; sharks.cooldown[i] = t.breedCooldown;
 }
 
-bool Wolf::canReproduce() const { return alive && energy > 100.f && m_reproCooldown <= 0.f; }
-void Wolf::resetReproduction() { energy -= 60.f; m_reproCooldown = 12.f; }
-void Wolf::draw(sf::RenderWindow& window) { shape.setPosition(pos); window.draw(shape); }
\ No newline at end of file
+// Noyaux instanciés pour la table compilée et pour une table chargée
+template std::optional<sf::Vector2f> Wolf::steer(const Population&, std::size_t, const PopulationSnapshot&, const FishIndex&, const Config::Builtin<Config::SHARK>&);
+template std::optional<sf::Vector2f> Wolf::steer(const Population&, std::size_t, const PopulationSnapshot&, const FishIndex&, const Config::Custom&);
+template std::uint32_t Wolf::findPrey(const Population&, std::size_t, const PopulationSnapshot&, const FishIndex&, const Config::Builtin<Config::SHARK>&);
+template std::uint32_t Wolf::findPrey(const Population&, std::size_t, const PopulationSnapshot&, const FishIndex&, const Config::Custom&);
@@ -0,0 +1,732 @@
+/**
+ * @file World.cpp
+ * @brief Moteur gérant la chaîne alimentaire : Plante -> Bactérie -> Poisson -> Requin.
+ * @details Tout l'état vit dans l'instance : aucune variable globale, aucun appel à rand().
+ * Un pas se déroule en trois temps :
+ * 1. Perception et déplacement, en parallèle par tranches : chaque agent n'écrit que
+ *    ses propres colonnes et lit l'autre espèce dans un cliché figé (tampon avant).
+ * 2. Fusion séquentielle, dans l'ordre des tranches, des interactions différées
+ *    (repas des requins, broutage, évolutions), puis accouplements et naissances.
+ * 3. Collisions, index, constat des morts et, si les trous sont trop nombreux, compactage.
+ */
+
+// AUCUN INCLUDE ICI (Géré par CMake)
+
+// Index des plantes : taille de cellule proche du rayon de broutage (15px)
+// pour que "première plante à portée" ne touche que 4 cellules.
+static constexpr float PLANT_CELL_SIZE = 32.f;
+
+// Champ d'algues : une cellule par touffe (de l'ordre du rayon de broutage).
+static constexpr float FIELD_CELL_SIZE = 16.f;
+
+// Distance de broutage (px).
+static constexpr float GRAZE_RANGE = 15.f;
+
+// Index des poissons chassables (niveau 2 uniquement)
+static constexpr float FISH_CELL_SIZE = 64.f;
+
+// Agents par tranche de mise à jour. Fixe : le découpage (donc l'ordre de fusion)
+// ne dépend pas du nombre de threads.
+static constexpr std::size_t UPDATE_CHUNK = 1024;
+
+// Blocs de collision (2x2 cellules) par tranche : la plupart sont vides ou presque.
+static constexpr std::size_t COLLISION_BLOCK_CHUNK = 16;
+
+// Réserve minimale par population : la croissance ordinaire d'un petit monde n'alloue pas.
+static constexpr std::size_t MIN_RESERVE = 256;
+
+// Compactage différé : les colonnes ne sont resserrées que lorsque plus d'un emplacement
+// sur MAX_HOLES_DIVISOR est un trou (les boucles parcourent donc au plus 1/3 de trous en plus).
+static constexpr std::size_t MAX_HOLES_DIVISOR = 4;
+
+/**
+ * @struct ChunkScratch
+ * @brief Tampons de perception d'une tranche (fuite, directions), propres à chaque thread.
+ * @details Ils ne servent que le temps d'une tranche : un jeu par thread suffit, réservé à la
+ * taille d'une tranche (le pire cas) à sa création. Un pas en régime établi n'alloue rien.
+ */
+struct ChunkScratch {
+    Sheep::Dangers dangers;
+    Motion::Steering steering;
+};
+
+static ChunkScratch& chunkScratch() {
+    thread_local ChunkScratch scratch = [] {
+        ChunkScratch s;
+        s.dangers.reserve(UPDATE_CHUNK);
+        s.steering.reserve(UPDATE_CHUNK);
+        return s;
+    }();
+    return scratch;
+}
+
+/**
+ * @brief Appelle fn(tranche, début, fin) sur [0, count), via la réserve de threads si elle existe.
+ */
+template <typename Fn>
+static void forChunks(ThreadPool* pool, std::size_t count, std::size_t chunkSize, Fn fn) {
+    if (pool) { pool->parallelFor(count, chunkSize, fn); return; }
+    for (std::size_t c = 0, begin = 0; begin < count; ++c, begin += chunkSize)
+        fn(c, begin, std::min(count, begin + chunkSize));
+}
+
+// -------------------------------------------------------------------------
+// CONSTRUCTEUR ET CONFIGURATION
+// -------------------------------------------------------------------------
+
+World::World(unsigned int seed, bool verbose) : m_rng(seed), m_verbose(verbose) {
+    rebuildPlantIndex();
+    rebuildFishIndex();
+}
+
+void World::seed(unsigned int seed) {
+    m_rng.seed(seed);
+}
+
+void World::setThreads(unsigned int threads) {
+    if (threads == 0) threads = std::max(1u, std::thread::hardware_concurrency());
+    if (threads > 1) m_pool = std::make_unique<ThreadPool>(threads);
+    else m_pool.reset();
+}
+
+void World::setCollisionIterations(int iterations) {
+    m_collisionIterations = std::max(1, iterations);
+}
+
+void World::setPlantModel(PlantModel model) {
+    m_plantModel = model;
+    m_plants.clear();
+    m_plantField.clear();
+    rebuildPlantIndex();
+}
+
+void World::setBounds(float xMin, float xMax, float yMin, float yMax) {
+    m_xMin = xMin; m_xMax = xMax;
+    m_yMin = yMin; m_yMax = yMax;
+    rebuildPlantIndex();
+    rebuildFishIndex();
+    syncFishIndex();
+}
+
+void World::init(int plants, int preyCount, int sharkCount) {
+    m_plants.clear();
+    m_plantField.clear();
+    m_prey.clear();
+    m_sharks.clear();
+    m_preyHandles.releaseAll();
+    m_sharkHandles.releaseAll();
+    m_simulationTime = 0.f;
+    m_deadPrey = 0; m_deadSharks = 0;
+    m_bornPrey = 0; m_bornSharks = 0;
+    recountStages();
+    m_step = 0;
+    m_epoch++;
+    m_frame.clear();
+    m_removedPrey.clear();
+    m_removedSharks.clear();
+
+    rebuildPlantIndex();
+    rebuildFishIndex();
+
+    for (int i = 0; i < plants; i++)     spawnPlant(randomPos());
+    for (int i = 0; i < preyCount; i++)  spawnPrey(randomPos(), randomWanderSeed());
+    for (int i = 0; i < sharkCount; i++) spawnShark(randomPos(), randomWanderSeed());
+    reserveGrowth();
+    m_initialised = true;
+}
+
+// -------------------------------------------------------------------------
+// MÉTHODES INTERNES
+// -------------------------------------------------------------------------
+
+sf::Vector2f World::randomPos() {
+    float margin = 30.f;
+    float x = m_xMin + margin + (m_rng() % (unsigned)std::max(1.f, m_xMax - m_xMin - margin * 2));
+    float y = m_yMin + margin + (m_rng() % (unsigned)std::max(1.f, m_yMax - m_yMin - margin * 2));
+    return {x, y};
+}
+
+void World::spawnPlant(sf::Vector2f p) {
+    if (m_plantModel == PlantModel::Field) { m_plantField.add(p); return; }
+    m_plantIndex.insert(m_plants.add(p), p);
+}
+
+/// Fait naître une Bactérie (tenue à jour des stades). @return Son indice.
+std::size_t World::spawnPrey(sf::Vector2f p, std::uint8_t wanderSeed) {
+    m_preyStages[1]++;
+    m_preyHandles.push();
+    return Sheep::spawn(m_prey, p, wanderSeed, stages());
+}
+
+void World::spawnShark(sf::Vector2f p, std::uint8_t wanderSeed) {
+    m_sharkHandles.push();
+    Wolf::spawn(m_sharks, p, wanderSeed, stages());
+}
+
+/// Recompte les stades d'un bloc (initialisation et chargement seulement).
+void World::recountStages() {
+    std::fill(std::begin(m_preyStages), std::end(m_preyStages), 0);
+    for (std::size_t i = 0; i < m_prey.size(); ++i)
+        if (m_prey.alive[i]) m_preyStages[std::min<int>(m_prey.level[i], 3)]++;
+}
+
+/**
+ * @brief Plante la plus proche à portée de vue d'une proie, selon le modèle de plantes.
+ * @details Lecture seule (index ou champ non modifiés pendant les déplacements) : sans verrou.
+ */
+std::optional<Sheep::Food> World::nearestFood(sf::Vector2f p, float range) const {
+    float distSq = 0.f;
+    if (m_plantModel == PlantModel::Field) {
+        if (auto cell = m_plantField.nearest(p, range, &distSq)) return Sheep::Food{*cell, distSq};
+    } else if (auto e = m_plantIndex.nearest(p, range, &distSq)) {
+        return Sheep::Food{{e->x, e->y}, distSq};
+    }
+    return std::nullopt;
+}
+
+/**
+ * @brief Dimensionne les tableaux pour le double de la population actuelle.
+ * @details Les proies et les requins peuvent tous naître ou évoluer dans un même pas :
+ * chaque tampon du pas est prévu pour le pire cas. Au-delà, les tableaux grandissent
+ * par doublement (Population::add, PlantStore::add), donc rarement.
+ */
+void World::reserveGrowth() {
+    std::size_t agents = std::max(MIN_RESERVE, 2 * (m_prey.size() + m_sharks.size()));
+    m_prey.reserve(agents);
+    m_sharks.reserve(agents);
+    m_preyHandles.reserve(agents);
+    m_sharkHandles.reserve(agents);
+    if (m_plantModel == PlantModel::Individual) m_plants.reserve(std::max(MIN_RESERVE, 2 * m_plants.size()));
+    m_preyFront.reserve(agents);
+    m_sharksFront.reserve(agents);
+    m_bodies.reserve(2 * agents);
+    m_fertile.reserve(agents);
+    m_frame.babyPrey.reserve(agents);
+    m_frame.babySharks.reserve(agents);
+    m_frame.newSharks.reserve(agents);
+    m_removedPrey.reserve(agents);
+    m_removedSharks.reserve(agents);
+}
+
+void World::rebuildPlantIndex() {
+    // Le champ n'existe (et n'occupe de mémoire) que dans le modèle Field ; il reporte sa biomasse
+    if (m_plantModel == PlantModel::Field) m_plantField.reset(m_xMin, m_xMax, m_yMin, m_yMax, FIELD_CELL_SIZE);
+    m_plantIndex.reset(m_xMin, m_xMax, m_yMin, m_yMax, PLANT_CELL_SIZE);
+    PlantStore::Id id = 0;
+    for (const Grass& p : m_plants) {
+        if (p.alive) m_plantIndex.insert(id, p.pos);
+        id++;
+    }
+}
+
+void World::rebuildFishIndex() {
+    m_fishIndex.reset(m_xMin, m_xMax, m_yMin, m_yMax, FISH_CELL_SIZE);
+    std::fill(m_prey.indexCell.begin(), m_prey.indexCell.end(), NOT_INDEXED);
+}
+
+/**
+ * @brief Met l'index des poissons en accord avec l'état des proies.
+ * @details Appelée une fois par pas, après tous les mouvements : insère les proies devenues
+ * poissons, retire les mortes ou évoluées, et ne déplace que celles qui ont changé de cellule.
+ */
+void World::syncFishIndex() {
+    Population& prey = m_prey;
+    for (std::uint32_t i = 0; i < prey.size(); ++i) {
+        bool shouldIndex = prey.alive[i] && prey.level[i] == 2;
+        std::uint32_t cell = prey.indexCell[i];
+        if (cell != NOT_INDEXED && !shouldIndex) {
+            m_fishIndex.removeFromCell(i, cell);
+            prey.indexCell[i] = NOT_INDEXED;
+        } else if (cell == NOT_INDEXED && shouldIndex) {
+            prey.indexCell[i] = m_fishIndex.insert(i, prey.pos(i));
+        } else if (cell != NOT_INDEXED) {
+            prey.indexCell[i] = m_fishIndex.update(i, cell, prey.pos(i));
+        }
+    }
+}
+
+void World::solveCollisions() {
+    PROFILE_SCOPE("collisions");
+    // Proies et requins dans le même tableau : les chevauchements proie/requin sont aussi résolus.
+    m_bodies.clear();
+    float maxRadius = 0.f;
+    auto gather = [&](Population& pop) {
+        for (std::uint32_t i = 0; i < pop.size(); ++i) {
+            if (!pop.alive[i]) continue;
+            m_bodies.push_back({&pop, i});
+            maxRadius = std::max(maxRadius, pop.radius[i]);
+        }
+    };
+    gather(m_prey);
+    gather(m_sharks);
+    if (m_bodies.size() < 2) return;
+
+    // Deux corps ne peuvent se toucher que si leur distance < 2 * rayon max :
+    // avec des cellules de cette taille, il suffit de tester les cellules voisines.
+    m_collisionGrid.build(m_xMin, m_xMax, m_yMin, m_yMax, 2.f * maxRadius, m_bodies.size(),
+                          [&](std::size_t b) { return m_bodies[b].pop->pos(m_bodies[b].i); });
+
+    auto resolve = [&](std::uint32_t a, std::uint32_t b) {
+        resolveCollision(*m_bodies[a].pop, m_bodies[a].i, *m_bodies[b].pop, m_bodies[b].i);
+    };
+
+    // Coloriage en damier de blocs 2x2 : les blocs d'une même couleur n'ont aucune cellule
+    // en commun, ils sont résolus en parallèle. Les 4 couleurs se suivent, et chaque
+    // itération de relaxation rejoue les 4 couleurs (la grille n'est construite qu'une fois).
+    int blockCols = m_collisionGrid.blockCols(), blockRows = m_collisionGrid.blockRows();
+    for (int iteration = 0; iteration < m_collisionIterations; ++iteration) {
+        for (int colour = 0; colour < 4; ++colour) {
+            int ox = colour & 1, oy = colour >> 1;
+            int cols = (blockCols - ox + 1) / 2, rows = (blockRows - oy + 1) / 2;
+            if (cols <= 0 || rows <= 0) continue;
+
+            forChunks(m_pool.get(), (std::size_t)cols * rows, COLLISION_BLOCK_CHUNK,
+                      [&](std::size_t, std::size_t begin, std::size_t end) {
+                PROFILE_SCOPE("collisions (tranche)");
+                for (std::size_t k = begin; k < end; ++k) {
+                    int bx = 2 * (int)(k % cols) + ox, by = 2 * (int)(k / cols) + oy;
+                    m_collisionGrid.forEachPairInBlock(bx, by, resolve);
+                }
+            });
+        }
+    }
+}
+
+/**
+ * @brief Constate les morts du pas : leur emplacement devient un trou, sans rien déplacer.
+ * @details La poignée est libérée et la position parquée hors de portée (les noyaux de
+ * recherche parcourent les clichés sans filtre). Les naissances étant toujours ajoutées en
+ * fin, l'ordre des vivantes est celui qu'aurait donné un compactage à chaque pas.
+ * @param stageCount Comptes par stade à décrémenter pour chaque entité retirée (ou nullptr).
+ * @param removed Reçoit le rang de chaque morte parmi les entités du pas, trous exclus (vidé d'abord).
+ */
+void World::reap(Population& pop, EntityHandles& handles, int& deadCounter, int* stageCount, std::vector<std::uint32_t>& removed) {
+    removed.clear();
+    std::uint32_t rank = 0;
+    for (std::uint32_t i = 0; i < pop.size(); ++i) {
+        if (!handles.occupied(i)) continue; // Trou d'un pas précédent
+        if (!pop.alive[i]) {
+            deadCounter++;
+            removed.push_back(rank);
+            if (stageCount) stageCount[std::min<int>(pop.level[i], 3)]--;
+            handles.release(i);
+            pop.x[i] = pop.y[i] = PARKED;
+        }
+        rank++;
+    }
+}
+
+/**
+ * @brief Reprend les trous en gardant l'ordre des vivantes.
+ * @param index Index spatial à renommer pour chaque entité déplacée (ou nullptr).
+ */
+void World::compact(Population& pop, EntityHandles& handles, FishIndex* index) {
+    std::size_t kept = 0;
+    for (std::size_t i = 0; i < pop.size(); ++i) {
+        if (!handles.occupied(i)) continue;
+        if (kept != i) {
+            if (index && pop.indexCell[i] != NOT_INDEXED)
+                index->relabel((std::uint32_t)i, (std::uint32_t)kept, pop.indexCell[i]);
+            pop.copy(i, kept);
+            handles.move((std::uint32_t)i, (std::uint32_t)kept);
+        }
+        kept++;
+    }
+    pop.truncate(kept);
+    handles.truncate(kept);
+}
+
+/**
+ * @brief Prend en charge des colonnes venues d'une sauvegarde : trous retirés, nouvelles poignées.
+ */
+void World::adopt(Population& pop, EntityHandles& handles) {
+    handles.releaseAll();
+    std::size_t kept = 0;
+    for (std::size_t i = 0; i < pop.size(); ++i) {
+        if (!pop.alive[i]) continue;
+        if (kept != i) pop.copy(i, kept);
+        kept++;
+    }
+    pop.truncate(kept);
+    for (std::size_t i = 0; i < kept; ++i) handles.push();
+}
+
+// -------------------------------------------------------------------------
+// SIMULATION
+// -------------------------------------------------------------------------
+
+void World::update(float dt) {
+    PROFILE_SCOPE("monde");
+    m_simulationTime += dt;
+    m_step++;
+
+    // 1. PLANTES (Apparition aléatoire, ou repousse du champ)
+    {
+        PROFILE_SCOPE("plantes");
+        if (m_plantModel == PlantModel::Field) m_plantField.regrow();
+        else if ((m_rng() % 100) < 7) spawnPlant(randomPos());
+    }
+
+    // 2. PERCEPTION ET DÉPLACEMENT (parallèle)
+    {
+        PROFILE_SCOPE("cliches");
+        m_preyFront.capture(m_prey);
+        m_sharksFront.capture(m_sharks);
+    }
+    updateSharks(dt);
+    updatePrey(dt);
+
+    // 3. FUSION (séquentielle, dans l'ordre des tranches : indépendante du nombre de threads)
+    FrameScratch& frame = m_frame;
+    frame.clear();
+    {
+        PROFILE_SCOPE("fusion");
+        applyKills(); // Les requins mangent avant que les poissons ne broutent
+        applyGrazing(frame.newSharks);
+        pairFertile(m_sharks, stages()[Config::SHARK].mateRange, Wolf::canReproduce, Wolf::resetReproduction,
+                    frame.babySharks, m_bornSharks);
+        pairFertile(m_prey, stages()[Config::FISH].mateRange, Sheep::canReproduce, Sheep::resetReproduction,
+                    frame.babyPrey, m_bornPrey);
+    }
+
+    solveCollisions();
+
+    // Intégration des nouveaux-nés et évolutions
+    {
+        PROFILE_SCOPE("naissances");
+        for (const auto& p : frame.babyPrey) spawnPrey(p, randomWanderSeed());
+        for (const auto& p : frame.babySharks) spawnShark(p, randomWanderSeed());
+        for (const auto& p : frame.newSharks) spawnShark(p, randomWanderSeed());
+    }
+
+    // Index des poissons : évolutions, morts et déplacements de ce pas
+    {
+        PROFILE_SCOPE("index");
+        syncFishIndex();
+    }
+
+    // Nettoyage : les mortes deviennent des trous ; les colonnes ne sont resserrées (chaque
+    // poisson déplacé renommé dans l'index) que lorsque les trous sont trop nombreux.
+    // Les plantes mangées ont déjà libéré leur emplacement pendant la fusion.
+    PROFILE_SCOPE("compactage");
+    reap(m_prey, m_preyHandles, m_deadPrey, m_preyStages, m_removedPrey);
+    reap(m_sharks, m_sharkHandles, m_deadSharks, nullptr, m_removedSharks);
+    if (m_preyHandles.holes() * MAX_HOLES_DIVISOR > m_prey.size()) compact(m_prey, m_preyHandles, &m_fishIndex);
+    if (m_sharkHandles.holes() * MAX_HOLES_DIVISOR > m_sharks.size()) compact(m_sharks, m_sharkHandles, nullptr);
+}
+
+// -------------------------------------------------------------------------
+// PHASES DU PAS
+// -------------------------------------------------------------------------
+
+void World::updateSharks(float dt) {
+    if (m_customStages) updateSharks(dt, Config::Custom{*m_customStages});
+    else updateSharks(dt, Config::Builtin<Config::SHARK>{});
+}
+
+void World::updatePrey(float dt) {
+    // Table compilée : une boucle de perception par stade, paramètres constants dans chacune
+    if (m_customStages) updatePrey(dt, Config::Custom{*m_customStages});
+    else updatePrey(dt, Config::Builtin<Config::BACTERIA>{}, Config::Builtin<Config::FISH>{});
+}
+
+template <typename Traits>
+void World::updateSharks(float dt, const Traits& traits) {
+    PROFILE_SCOPE("requins");
+    Population& sharks = m_sharks;
+    std::size_t n = sharks.size();
+    m_sharkEvents.resize(ThreadPool::chunkCount(n, UPDATE_CHUNK));
+
+    const Motion::Params params{dt, m_simulationTime, m_xMin, m_xMax, m_yMin, m_yMax};
+
+    forChunks(m_pool.get(), n, UPDATE_CHUNK, [&](std::size_t c, std::size_t begin, std::size_t end) {
+        PROFILE_SCOPE("requins (tranche)");
+        ChunkEvents& events = m_sharkEvents[c];
+        events.kills.clear();
+
+        // Perception : une direction par requin (positions du début du pas)
+        Motion::Steering& steering = chunkScratch().steering;
+        steering.resize(end - begin);
+        for (std::size_t i = begin; i < end; ++i) {
+            if (!sharks.alive[i]) { steering.set(i - begin, {0.f, 0.f}); continue; } // Trou : masqué par le noyau
+            if (auto dir = Wolf::steer(sharks, i, m_preyFront, m_fishIndex, traits)) steering.set(i - begin, *dir);
+            else steering.setWander(i - begin);
+        }
+
+        // Métabolisme, errance, déplacement et murs : une passe sur les colonnes
+        Motion::integrate(sharks, begin, end, steering, params, traits);
+
+        // Mange uniquement les poissons (Level 2) : la mise à mort attend la fusion
+        for (std::size_t i = begin; i < end; ++i) {
+            if (!sharks.alive[i]) continue; // Trou, ou mort de faim ou contre un mur à l'instant
+            std::uint32_t fish = Wolf::findPrey(sharks, i, m_preyFront, m_fishIndex, traits);
+            if (fish != Wolf::NO_PREY) events.kills.push_back({(std::uint32_t)i, fish});
+        }
+    });
+}
+
+template <typename Traits>
+void World::perceivePrey(std::size_t begin, std::size_t end, Sheep::Dangers& dangers, Motion::Steering& steering,
+                         const Traits& traits) {
+    const Population& prey = m_prey;
+    Sheep::findDangers(prey, begin, end, m_sharksFront, dangers, traits);
+
+    // Perception : une direction par proie du stade (positions du début du pas)
+    std::size_t k = 0; // Curseur dans dangers.fish (mêmes indices croissants)
+    for (std::size_t i = begin; i < end; ++i) {
+        if (!prey.alive[i] || !traits.has(prey.level[i])) continue; // Trou, ou autre stade
+        std::uint32_t danger = Nearest::NONE;
+        if constexpr (Traits::FLEES)
+            if (k < dangers.fish.size() && dangers.fish[k] == i) danger = dangers.shark[k++];
+
+        std::optional<Sheep::Food> food;
+        if (danger == Nearest::NONE) food = nearestFood(prey.pos(i), traits.stage(prey.level[i]).foodRange);
+        if (auto dir = Sheep::steer(prey, i, danger, m_sharksFront, food, traits)) steering.set(i - begin, *dir);
+        else steering.setWander(i - begin);
+    }
+}
+
+template <typename... Stages>
+void World::updatePrey(float dt, const Stages&... stages) {
+    PROFILE_SCOPE("proies");
+    Population& prey = m_prey;
+    std::size_t n = prey.size();
+    m_preyEvents.resize(ThreadPool::chunkCount(n, UPDATE_CHUNK));
+
+    const Motion::Params params{dt, m_simulationTime, m_xMin, m_xMax, m_yMin, m_yMax};
+
+    forChunks(m_pool.get(), n, UPDATE_CHUNK, [&](std::size_t c, std::size_t begin, std::size_t end) {
+        PROFILE_SCOPE("proies (tranche)");
+        ChunkEvents& events = m_preyEvents[c];
+        events.grazes.clear();
+
+        // Une boucle par stade (les trous restent immobiles : masqués par le noyau)
+        ChunkScratch& scratch = chunkScratch();
+        scratch.steering.reset(end - begin);
+        (perceivePrey(begin, end, scratch.dangers, scratch.steering, stages), ...);
+
+        // Métabolisme, errance, déplacement et murs : une passe sur les colonnes
+        Motion::integrate(prey, begin, end, scratch.steering, params, stages...);
+
+        for (std::size_t i = begin; i < end; ++i) {
+            if (!prey.alive[i]) continue; // Trou, ou mort de faim ou contre un mur à l'instant
+            // Les plantes ne sont pas modifiées pendant cette phase : lecture sans verrou.
+            // Champ : la cellule de la proie (O(1)). Individuelles : première à portée.
+            if (m_plantModel == PlantModel::Field) {
+                std::uint32_t cell = m_plantField.cellOf(prey.pos(i));
+                if (m_plantField.biomass(cell)) events.grazes.push_back({(std::uint32_t)i, cell});
+            } else if (auto e = m_plantIndex.firstWithin(prey.pos(i), GRAZE_RANGE)) {
+                events.grazes.push_back({(std::uint32_t)i, e->id});
+            }
+        }
+    });
+}
+
+void World::applyKills() {
+    for (const ChunkEvents& events : m_sharkEvents) {
+        for (const auto& kill : events.kills) {
+            // Déjà mangé par un requin précédent (ou mort de faim ce pas-ci) : repas manqué
+            if (!m_prey.alive[kill.second]) continue;
+            m_prey.alive[kill.second] = 0; // Retiré de l'index par syncFishIndex
+            Wolf::eat(m_sharks, kill.first, stages());
+        }
+    }
+}
+
+void World::applyGrazing(std::vector<sf::Vector2f>& newSharks) {
+    Population& prey = m_prey;
+    for (const ChunkEvents& events : m_preyEvents) {
+        for (const auto& graze : events.grazes) {
+            std::uint32_t i = graze.first;
+            if (!prey.alive[i]) continue; // Proie mangée par un requin
+
+            if (m_plantModel == PlantModel::Field) {
+                if (!m_plantField.graze(graze.second)) continue; // Cellule vidée par les proies précédentes
+            } else {
+                // Plante prise par une proie précédente (aucune apparition pendant la fusion :
+                // un emplacement libéré n'est pas réattribué avant la fin du pas)
+                PlantStore::Id plant = graze.second;
+                if (!m_plants[plant].alive) continue;
+                m_plantIndex.remove(plant, m_plants[plant].pos);
+                m_plants.remove(plant);
+            }
+            // Gère l'évolution interne (Niveau 1 -> 2)
+            std::uint8_t before = prey.level[i];
+            if (Sheep::eatGrass(prey, i, stages())) {
+                m_preyStages[before]--;
+                m_preyStages[prey.level[i]]++;
+                if (prey.level[i] == 2 && m_verbose)
+                    std::clog << "EVOLUTION : Poisson !" << std::endl; // Journal (stderr) : ne pollue pas les sorties CSV
+            }
+
+            // EVOLUTION ULTIME : Poisson (Niveau 2) -> Requin (Niveau 3)
+            if (prey.level[i] == 3) {
+                newSharks.push_back(prey.pos(i));
+                prey.alive[i] = 0; // Le poisson "disparaît" pour devenir un requin
+            }
+        }
+    }
+}
+
+/**
+ * @brief Forme les couples : chaque candidat s'accouple avec le premier candidat suivant à portée.
+ * @details Même règle que l'ancienne double boucle sur toute la population, mais restreinte
+ * aux agents fertiles, rangés dans une grille de cellules de la taille du rayon : chaque
+ * candidat ne regarde que les fertiles des cellules voisines et garde le plus petit indice
+ * encore libre (le premier qu'aurait trouvé la double boucle). Un boom de population ne
+ * coûte plus que O(fertiles x voisins).
+ */
+void World::pairFertile(Population& pop, float radius,
+                        bool (*canReproduce)(const Population&, std::size_t, const Config::StageTable&),
+                        void (*reset)(Population&, std::size_t, const Config::StageTable&),
+                        std::vector<sf::Vector2f>& babies, int& bornCounter) {
+    PROFILE_SCOPE("accouplements");
+    const Config::StageTable& traits = stages();
+    m_fertile.clear();
+    for (std::uint32_t i = 0; i < pop.size(); ++i)
+        if (canReproduce(pop, i, traits)) m_fertile.push_back(i);
+    if (m_fertile.size() < 2) return;
+
+    m_mateGrid.build(m_xMin, m_xMax, m_yMin, m_yMax, radius, m_fertile.size(),
+                     [&](std::size_t b) { return pop.pos(m_fertile[b]); });
+
+    float radiusSq = radius * radius;
+    for (std::size_t a = 0; a < m_fertile.size(); ++a) {
+        std::uint32_t i = m_fertile[a];
+        if (!canReproduce(pop, i, traits)) continue; // Déjà accouplé
+        std::uint32_t best = (std::uint32_t)m_fertile.size();
+        m_mateGrid.forEachNear(pop.x[i], pop.y[i], radius, [&](std::uint32_t b) {
+            if (b <= a || b >= best) return;
+            std::uint32_t j = m_fertile[b];
+            if (canReproduce(pop, j, traits) && pop.distSq(i, pop.pos(j)) < radiusSq) best = b;
+        });
+        if (best == m_fertile.size()) continue;
+        babies.push_back(pop.pos(i));
+        reset(pop, i, traits); reset(pop, m_fertile[best], traits);
+        bornCounter++;
+    }
+}
+
+void World::spawn(EntityType type, float x, float y) {
+    sf::Vector2f p(x, y);
+    switch (type) {
+        case EntityType::Plant:    spawnPlant(p); break;
+        case EntityType::Bacteria: spawnPrey(p, randomWanderSeed()); break;
+        case EntityType::Fish:
+            Sheep::becomeStage(m_prey, spawnPrey(p, randomWanderSeed()), Config::FISH, stages());
+            m_preyStages[1]--; m_preyStages[2]++;
+            break;
+        case EntityType::Shark:    spawnShark(p, randomWanderSeed()); break;
+    }
+}
+
+// -------------------------------------------------------------------------
+// SAUVEGARDE
+// -------------------------------------------------------------------------
+
+void World::capture(WorldState& out) const {
+    PROFILE_SCOPE("capture");
+    out.xMin = m_xMin; out.xMax = m_xMax;
+    out.yMin = m_yMin; out.yMax = m_yMax;
+    out.simulationTime = m_simulationTime;
+    out.deadPrey = m_deadPrey; out.deadSharks = m_deadSharks;
+    out.bornPrey = m_bornPrey; out.bornSharks = m_bornSharks;
+
+    // Affectations de vecteurs : la capacité de la capture précédente est réutilisée.
+    // Les trous sont copiés tels quels (alive = 0) et retirés au chargement.
+    out.prey = m_prey;
+    out.sharks = m_sharks;
+    out.plantModel = m_plantModel;
+    if (m_plantModel == PlantModel::Field) {
+        out.plantSlots.clear();
+        out.plantFree.clear();
+        out.fieldCells = m_plantField.cells();
+        out.fieldCols = (std::uint32_t)m_plantField.cols();
+        out.fieldRows = (std::uint32_t)m_plantField.rows();
+        out.fieldTick = m_plantField.tick();
+    } else {
+        out.plantSlots = m_plants.slots();
+        out.plantFree = m_plants.freeSlots();
+        out.fieldCells.clear();
+        out.fieldCols = out.fieldRows = out.fieldTick = 0;
+    }
+    out.rng = m_rng;
+}
+
+void World::restore(WorldState&& state) {
+    m_xMin = state.xMin; m_xMax = state.xMax;
+    m_yMin = state.yMin; m_yMax = state.yMax;
+    m_simulationTime = state.simulationTime;
+    m_deadPrey = state.deadPrey; m_deadSharks = state.deadSharks;
+    m_bornPrey = state.bornPrey; m_bornSharks = state.bornSharks;
+
+    // Les colonnes sont échangées : l'état reçu garde les anciennes (réutilisables)
+    std::swap(m_prey, state.prey);
+    std::swap(m_sharks, state.sharks);
+    adopt(m_prey, m_preyHandles);
+    adopt(m_sharks, m_sharkHandles);
+    std::fill(m_prey.indexCell.begin(), m_prey.indexCell.end(), NOT_INDEXED);
+    std::fill(m_sharks.indexCell.begin(), m_sharks.indexCell.end(), NOT_INDEXED);
+
+    m_plantModel = state.plantModel;
+    m_plantField.clear();
+    if (m_plantModel == PlantModel::Field) m_plants.clear();
+    else m_plants.assign(std::move(state.plantSlots), std::move(state.plantFree));
+    rebuildPlantIndex();
+    if (m_plantModel == PlantModel::Field) m_plantField.assign(state.fieldCells, state.fieldTick);
+
+    rebuildFishIndex();
+    syncFishIndex();
+    recountStages();
+    m_step = 0;
+    m_epoch++;
+    m_frame.clear();
+    m_removedPrey.clear();
+    m_removedSharks.clear();
+    m_rng = state.rng;
+    reserveGrowth();
+    m_initialised = true;
+}
+
+bool World::save(const std::string& path) const {
+    WorldState state;
+    capture(state);
+    return saveSnapshot(path, state);
+}
+
+bool World::load(const std::string& path) {
+    WorldState state;
+    if (!loadSnapshot(path, state)) return false;
+    if (state.plantModel == PlantModel::Field) {
+        // Le champ est redimensionné d'après les limites : la grille sauvée doit y correspondre
+        PlantField check;
+        check.reset(state.xMin, state.xMax, state.yMin, state.yMax, FIELD_CELL_SIZE);
+        if ((std::uint32_t)check.cols() != state.fieldCols || (std::uint32_t)check.rows() != state.fieldRows) return false;
+    }
+    restore(std::move(state));
+    return true;
+}
+
+// -------------------------------------------------------------------------
+// ACCÈS EN LECTURE
+// -------------------------------------------------------------------------
+
+EcosystemStats World::getStats() const {
+    // Comptes tenus à jour pendant le pas : aucun parcours des proies
+    int bac = m_preyStages[1];
+    int fish = m_preyStages[2];
+
+    // Retourne la structure en respectant l'ordre défini dans Stats.hpp
+    return { 
+        (int)(m_plantModel == PlantModel::Field ? m_plantField.total() : m_plants.size()), 
+        (int)m_preyHandles.live(), 
+        bac, 
+        fish, 
+        (int)m_sharkHandles.live(), 
+        m_deadPrey, 
+        m_deadSharks, 
+        m_bornPrey, 
+        m_bornSharks, 
+        m_simulationTime 
+    };
+}
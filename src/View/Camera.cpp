@@ -0,0 +1,61 @@
+/**
+ * @file Camera.cpp
+ * @author Sasha Marie te Rehorst (sasha.marieterehorst@gmail.com)
+ * @author Gael Guinaliu (rodez.gael@gmail.com)
+ * @brief Zoom et déplacement de la vue sur le monde.
+ * @version 1.0
+ * @date 2026-01-24
+ */
+
+// AUCUN INCLUDE ICI (Géré par CMake)
+
+void Camera::setArea(sf::FloatRect area, sf::Vector2u windowSize) {
+    m_area = area;
+    m_windowSize = {std::max(1u, windowSize.x), std::max(1u, windowSize.y)};
+    apply();
+}
+
+void Camera::setWorld(sf::FloatRect world) {
+    if (world == m_world) return;
+    m_world = world;
+    reset();
+}
+
+void Camera::reset() {
+    m_zoom = 1.f;
+    m_center = m_world.position + m_world.size * 0.5f;
+    apply();
+}
+
+void Camera::zoomAt(sf::Vector2i pixel, float factor) {
+    // Point du monde sous la souris, avant et après : on décale le centre pour qu'il ne bouge pas
+    sf::Vector2f fromCenter = sf::Vector2f(pixel) - (m_area.position + m_area.size * 0.5f);
+    sf::Vector2f anchor = m_center + fromCenter / pixelsPerUnit();
+    m_zoom *= factor;
+    m_zoom = std::clamp(m_zoom, 1.f, std::max(1.f, MAX_PIXELS_PER_UNIT / m_fitScale));
+    m_center = anchor - fromCenter / pixelsPerUnit();
+    apply();
+}
+
+void Camera::pan(sf::Vector2i delta) {
+    m_center -= sf::Vector2f(delta) / pixelsPerUnit();
+    apply();
+}
+
+void Camera::apply() {
+    float worldW = std::max(1.f, m_world.size.x), worldH = std::max(1.f, m_world.size.y);
+    m_fitScale = std::max(1e-6f, std::min(m_area.size.x / worldW, m_area.size.y / worldH));
+    m_zoom = std::clamp(m_zoom, 1.f, std::max(1.f, MAX_PIXELS_PER_UNIT / m_fitScale));
+
+    // La vue couvre toute la zone de jeu ; sur un axe où elle dépasse le monde, il est centré
+    sf::Vector2f size = m_area.size / pixelsPerUnit();
+    sf::Vector2f lo = m_world.position + size * 0.5f, hi = m_world.position + m_world.size - size * 0.5f;
+    m_center.x = (lo.x <= hi.x) ? std::clamp(m_center.x, lo.x, hi.x) : m_world.position.x + m_world.size.x * 0.5f;
+    m_center.y = (lo.y <= hi.y) ? std::clamp(m_center.y, lo.y, hi.y) : m_world.position.y + m_world.size.y * 0.5f;
+
+    m_view.setCenter(m_center);
+    m_view.setSize(size);
+    sf::Vector2f window(m_windowSize);
+    m_view.setViewport(sf::FloatRect({m_area.position.x / window.x, m_area.position.y / window.y},
+                                     {m_area.size.x / window.x, m_area.size.y / window.y}));
+}
@@ -5,7 +5,7 @@
 
 // AUCUN INCLUDE ICI
 
-Hud::Hud() : m_textFps(m_font), m_textInfo(m_font), m_textTitle(m_font) { m_width = 260.f; }
+Hud::Hud() : m_textFps(m_font), m_textInfo(m_font), m_textTitle(m_font), m_textProfile(m_font), m_textGraph(m_font), m_textStatus(m_font) { m_width = 260.f; }
 
 bool Hud::init(sf::Vector2u windowSize) {
     if (!m_font.openFromFile("assets/font.ttf")) return false;
@@ -16,6 +16,9 @@ bool Hud::init(sf::Vector2u windowSize) {
     m_textFps.setCharacterSize(14); m_textFps.setFillColor(sf::Color::Cyan);
     m_textFps.setPosition({10.f, 10.f});
 
+    m_textStatus.setCharacterSize(12); m_textStatus.setFillColor(sf::Color(255, 200, 80));
+    m_textStatus.setPosition({10.f, 30.f});
+
     m_textTitle.setString("OCEAN STATS");
     m_textTitle.setCharacterSize(20); m_textTitle.setFillColor(sf::Color::White);
     m_textTitle.setStyle(sf::Text::Bold);
@@ -25,14 +28,37 @@ bool Hud::init(sf::Vector2u windowSize) {
     m_textInfo.setPosition({20.f, 100.f});
     m_textInfo.setLineSpacing(1.4f);
 
+    m_textProfile.setCharacterSize(12); m_textProfile.setFillColor(sf::Color(150, 180, 210));
+    m_textProfile.setPosition({20.f, 420.f});
+
+    // Courbes aux teintes des entités ; les algues ont leur propre échelle
+    m_textGraph.setString("HISTORIQUE (2 min)");
+    m_textGraph.setCharacterSize(11); m_textGraph.setFillColor(sf::Color(150, 180, 210));
+    layoutGraph(windowSize);
+
     return true;
 }
 
+void Hud::layoutGraph(sf::Vector2u windowSize) {
+    float top = (float)windowSize.y - 150.f;
+    m_textGraph.setPosition({10.f, top - 16.f});
+    m_graph.setArea(sf::FloatRect({10.f, top}, {m_width - 20.f, 120.f}));
+}
+
 void Hud::update(float fps, int grass, int totalPrey, int bac, int fish, int sharks, 
                 int deadP, int deadS, int bornP, int bornS) 
 {
-    m_textFps.setString("FPS: " + std::to_string((int)fps));
-    
+    // sf::Text refait sa mise en page à chaque setString : seulement si l'affichage change
+    if ((int)fps != m_shownFps) {
+        m_shownFps = (int)fps;
+        m_textFps.setString("FPS: " + std::to_string(m_shownFps));
+    }
+
+    std::array<int, 9> values = {grass, totalPrey, bac, fish, sharks, deadP, deadS, bornP, bornS};
+    if (m_hasInfo && values == m_shownInfo) return;
+    m_shownInfo = values;
+    m_hasInfo = true;
+
     std::string info = "";
     info += "Algues:    " + std::to_string(grass) + "\n\n";
     info += "BACTERIES: " + std::to_string(bac) + "\n";
@@ -41,14 +67,48 @@ void Hud::update(float fps, int grass, int totalPrey, int bac, int fish, int sha
     info += "--- MORTS ---\n";
     info += "Poissons:  " + std::to_string(deadP) + "\n";
     info += "Requins:   " + std::to_string(deadS) + "\n\n";
-    info += "[P] Pause  [R] Reset";
+    info += "[P] Pause  [R] Reset\n[Molette] Zoom  [C] Recadrer";
+    if (Profiler::ENABLED) info += "\n[T] Trace Chrome";
     
     m_textInfo.setString(info);
 }
 
+void Hud::setStatus(const std::string& status) {
+    if (status == m_shownStatus) return;
+    m_shownStatus = status;
+    m_textStatus.setString(status);
+}
+
+void Hud::setProfile(const std::vector<Profiler::PhaseTiming>& phases) {
+    auto frame = std::find_if(phases.begin(), phases.end(), [](const Profiler::PhaseTiming& p) { return std::string(p.name) == "image"; });
+    if (frame == phases.end()) { m_textProfile.setString(""); return; }
+
+    double frameMs = frame->totalMs / frame->calls;
+    std::ostringstream text;
+    text << std::fixed << std::setprecision(2) << "--- TEMPS / IMAGE ---\n";
+    int lines = 0;
+    for (const auto& p : phases) { // Déjà triées par temps cumulé
+        if (&p == &*frame) continue;
+        if (lines++ == 12) break; // Les 12 plus coûteuses : le panneau n'en contient pas plus
+        double ms = p.totalMs / frame->calls;
+        text << std::left << std::setw(20) << p.name << std::right << std::setw(6) << ms << " ms "
+             << std::setw(4) << (int)(100.0 * ms / frameMs) << "%\n";
+    }
+    text << std::left << std::setw(20) << "image" << std::right << std::setw(6) << frameMs << " ms";
+    m_textProfile.setString(text.str());
+}
+
 void Hud::draw(sf::RenderWindow& window) {
+    PROFILE_SCOPE("hud");
     window.draw(m_background); window.draw(m_textTitle);
     window.draw(m_textFps); window.draw(m_textInfo);
+    if (!m_shownStatus.empty()) window.draw(m_textStatus);
+    window.draw(m_textProfile);
+    window.draw(m_textGraph);
+    m_graph.draw(window);
 }
 
-void Hud::onResize(sf::Vector2u newSize) { m_background.setSize({m_width, (float)newSize.y}); }
\ No newline at end of file
+void Hud::onResize(sf::Vector2u newSize) {
+    m_background.setSize({m_width, (float)newSize.y});
+    layoutGraph(newSize);
+}
\ No newline at end of file
@@ -0,0 +1,83 @@
+/**
+ * @file PopulationGraph.cpp
+ * @author Sasha Marie te Rehorst (sasha.marieterehorst@gmail.com)
+ * @author Gael Guinaliu (rodez.gael@gmail.com)
+ * @brief Échantillonnage et tracé des courbes de population.
+ * @version 1.0
+ * @date 2026-01-19
+ */
+
+// AUCUN INCLUDE ICI (Géré par CMake)
+
+// Mêmes teintes que les entités dessinées par le Renderer
+static const sf::Color SERIES_COLORS[] = {
+    sf::Color(50, 200, 50),   // Algues
+    sf::Color(0, 255, 100),   // Bactéries
+    sf::Color(0, 150, 255),   // Poissons
+    sf::Color(200, 200, 220), // Requins (gris clair : lisible sur le fond sombre)
+};
+
+PopulationGraph::PopulationGraph() : m_lines(sf::PrimitiveType::Lines) {
+    m_frame.setFillColor(sf::Color(0, 0, 0, 80));
+    m_frame.setOutlineColor(sf::Color(60, 90, 120));
+    m_frame.setOutlineThickness(1.f);
+    m_lines.resize(2 * (CAPACITY - 1) * SERIES_COUNT); // Capacité maximale réservée une fois
+    m_lines.clear();
+}
+
+void PopulationGraph::clear() {
+    m_head = 0;
+    m_count = 0;
+    m_lastSample = -1.f;
+    m_dirty = true;
+}
+
+void PopulationGraph::record(const EcosystemStats& stats) {
+    if (stats.simulationTime < m_lastSample) clear();
+    if (m_lastSample >= 0.f && stats.simulationTime - m_lastSample < SAMPLE_PERIOD) return;
+
+    m_lastSample = stats.simulationTime;
+    m_samples[PLANTS][m_head] = stats.plants;
+    m_samples[BACTERIA][m_head] = stats.bacteria;
+    m_samples[FISH][m_head] = stats.fish;
+    m_samples[SHARKS][m_head] = stats.sharks;
+    m_head = (m_head + 1) % CAPACITY;
+    m_count = std::min(m_count + 1, CAPACITY);
+    m_dirty = true;
+}
+
+void PopulationGraph::rebuild() {
+    m_dirty = false;
+    m_frame.setPosition(m_area.position);
+    m_frame.setSize(m_area.size);
+    m_lines.clear();
+    if (m_count < 2) return;
+
+    // Les algues ont leur propre échelle (souvent bien plus nombreuses) ; les animaux partagent la leur
+    std::size_t first = (m_head + CAPACITY - m_count) % CAPACITY;
+    int plantMax = 1, animalMax = 1;
+    for (std::size_t k = 0; k < m_count; ++k) {
+        std::size_t i = (first + k) % CAPACITY;
+        plantMax = std::max(plantMax, m_samples[PLANTS][i]);
+        for (int s = BACTERIA; s < SERIES_COUNT; ++s) animalMax = std::max(animalMax, m_samples[s][i]);
+    }
+
+    // Le plus récent à droite : l'historique défile vers la gauche
+    float step = m_area.size.x / (float)(CAPACITY - 1);
+    float x0 = m_area.position.x + m_area.size.x - step * (float)(m_count - 1);
+    float bottom = m_area.position.y + m_area.size.y;
+    for (int s = 0; s < SERIES_COUNT; ++s) {
+        float scale = m_area.size.y / (float)(s == PLANTS ? plantMax : animalMax);
+        for (std::size_t k = 1; k < m_count; ++k) {
+            std::size_t a = (first + k - 1) % CAPACITY, b = (first + k) % CAPACITY;
+            m_lines.append({{x0 + step * (float)(k - 1), bottom - m_samples[s][a] * scale}, SERIES_COLORS[s]});
+            m_lines.append({{x0 + step * (float)k, bottom - m_samples[s][b] * scale}, SERIES_COLORS[s]});
+        }
+    }
+}
+
+void PopulationGraph::draw(sf::RenderWindow& window) {
+    if (m_dirty) rebuild();
+    window.draw(m_frame);
+    window.draw(m_lines);
+}
@@ -2,9 +2,9 @@
  * @file Renderer.cpp
  * @author Sasha Marie te Rehorst (sasha.marieterehorst@gmail.com)
  * @author Gael Guinaliu (rodez.gael@gmail.com)
- * @brief Gestion de l'affichage du terrain de jeu.
- * @version 0.4
- * @date 2026-01-05
+ * @brief Gestion de l'affichage du terrain de jeu et des entités.
+ * @version 0.8
+ * @date 2026-01-26
  */
 
 
@@ -12,8 +12,8 @@
 // CONSTRUCTEUR
 // -------------------------------------------------------------------------
 
-Renderer::Renderer() {
-    // Rien à faire ici
+Renderer::Renderer() : m_batch(sf::PrimitiveType::Triangles) {
+    // Rien à faire ici (l'atlas a besoin d'un contexte OpenGL : voir init())
 }
 
 // -------------------------------------------------------------------------
@@ -21,25 +21,263 @@ Renderer::Renderer() {
 // -------------------------------------------------------------------------
 
 void Renderer::init(sf::Vector2u windowSize, float hudWidth) {
-    // Aléatoire global
-    std::srand(static_cast<unsigned int>(std::time(nullptr)));
-
     // Style du terrain (Noir avec bordure grise)
-    m_gameArea.setFillColor(sf::Color(0, 105, 148)); // Bleu océan
+    m_gameArea.setFillColor(sf::Color(0, 60, 90)); // Grand large : hors du monde, visible au dézoom
     m_gameArea.setOutlineThickness(-2.f);
     m_gameArea.setOutlineColor(sf::Color(127, 255, 212)); // Aquamarine pour l'écume
-    // Calcul de la taille et lancement de la simulation
+    m_worldArea.setFillColor(sf::Color(0, 105, 148)); // Bleu océan
+    m_worldArea.setOutlineColor(sf::Color(127, 255, 212));
+    // Calcul de la taille (le monde est peuplé par l'Application, une fois ses bordures connues)
     onResize(windowSize, hudWidth);
-    initEcosystem();
+    buildAtlas();
+}
+
+void Renderer::buildAtlas() {
+    // Case 0 : disque blanc plein. Case 1 : disque blanc cerclé de noir (requin, contour 2px sur 14px).
+    const float R = ATLAS_CELL * 0.5f - 1.f; // 1px de marge transparente contre le filtrage
+    const float sharkInner = R * (12.f / 14.f);
+
+    sf::Image img({ATLAS_CELL * SPRITE_COUNT, ATLAS_CELL}, sf::Color::Transparent);
+    for (unsigned sprite = 0; sprite < SPRITE_COUNT; ++sprite) {
+        for (unsigned y = 0; y < ATLAS_CELL; ++y) {
+            for (unsigned x = 0; x < ATLAS_CELL; ++x) {
+                float dx = x + 0.5f - ATLAS_CELL * 0.5f, dy = y + 0.5f - ATLAS_CELL * 0.5f;
+                float d = std::sqrt(dx * dx + dy * dy);
+                float alpha = std::clamp(R - d + 0.5f, 0.f, 1.f); // Bord anticrénelé
+                if (alpha <= 0.f) continue;
+
+                std::uint8_t shade = 255;
+                if (sprite == SPRITE_SHARK) shade = (std::uint8_t)(255.f * std::clamp(sharkInner - d + 0.5f, 0.f, 1.f));
+                img.setPixel({sprite * ATLAS_CELL + x, y}, sf::Color(shade, shade, shade, (std::uint8_t)(alpha * 255.f)));
+            }
+        }
+    }
+    if (!m_atlas.loadFromImage(img)) std::cerr << "Renderer : impossible de créer l'atlas" << std::endl;
+    m_atlas.setSmooth(true);
 }
 
 // -------------------------------------------------------------------------
 // RENDU (DRAW)
 // -------------------------------------------------------------------------
 
-void Renderer::draw(sf::RenderWindow& window) {
+void Renderer::draw(sf::RenderWindow& window, const RenderSnapshot& snapshot, float alpha) {
+    // Image du thread de simulation : ses index évitent de parcourir les entités hors de l'écran
+    RenderScene scene;
+    scene.plantModel = snapshot.plantModel;
+    scene.plants = &snapshot.plants;
+    scene.field = &snapshot.field;
+    scene.prey = &snapshot.prey;
+    scene.sharks = &snapshot.sharks;
+    scene.bounds = sf::FloatRect(snapshot.boundsMin, snapshot.boundsMax - snapshot.boundsMin);
+    scene.preyFrom = &snapshot.preyFrom;
+    scene.sharksFrom = &snapshot.sharksFrom;
+    scene.alpha = alpha;
+    scene.frame = snapshot.sequence; // Image publiée en sprites sous un zoom d'ensemble : recomptée une seule fois
+    // L'image porte ce que le zoom demandait à sa publication (sinon : repli sur les colonnes)
+    if (snapshot.withDensity) {
+        scene.density = &snapshot.density;
+    } else {
+        scene.plantRegions = &snapshot.plantRegions;
+        scene.preyRegions = &snapshot.preyRegions;
+        scene.sharkRegions = &snapshot.sharkRegions;
+    }
+    draw(window, scene);
+}
+
+void Renderer::draw(sf::RenderWindow& window, const RenderScene& scene) {
+    PROFILE_SCOPE("rendu");
     window.draw(m_gameArea); // 1. Fond
-    ecosystemDraw(window);   // 2. Animaux
+
+    // Vue de la caméra sur le monde (recadré en entier s'il a changé)
+    bool hasBounds = scene.bounds.size.x > 0.f && scene.bounds.size.y > 0.f;
+    sf::FloatRect world = hasBounds ? scene.bounds : sf::FloatRect(m_gameArea.getPosition(), m_gameArea.getSize());
+    m_camera.setWorld(world);
+    const sf::View defaultView = window.getDefaultView();
+    window.setView(m_camera.view());
+
+    // 2. Étendue du monde (bord de 2 pixels quel que soit le zoom)
+    m_worldArea.setPosition(world.position);
+    m_worldArea.setSize(world.size);
+    m_worldArea.setOutlineThickness(-2.f / m_camera.pixelsPerUnit());
+    window.draw(m_worldArea);
+
+    // 3. Densités (vue d'ensemble) : aussi quand l'image n'a plus que sa grille (zoom tout juste changé)
+    if (scene.density || lodActive()) drawDensity(window, scene);
+    else drawEcosystem(window, scene);                             // 3. Animaux
+    window.setView(defaultView);
+}
+
+void Renderer::appendSprite(sf::Vector2f center, float halfSize, sf::Color color, Sprite sprite) {
+    float u0 = (float)(sprite * ATLAS_CELL), u1 = u0 + ATLAS_CELL, v1 = (float)ATLAS_CELL;
+    float x0 = center.x - halfSize, x1 = center.x + halfSize;
+    float y0 = center.y - halfSize, y1 = center.y + halfSize;
+
+    // SFML 3 n'a plus de Quads : deux triangles par sprite
+    m_batch.append({{x0, y0}, color, {u0, 0.f}});
+    m_batch.append({{x1, y0}, color, {u1, 0.f}});
+    m_batch.append({{x1, y1}, color, {u1, v1}});
+    m_batch.append({{x0, y0}, color, {u0, 0.f}});
+    m_batch.append({{x1, y1}, color, {u1, v1}});
+    m_batch.append({{x0, y1}, color, {u0, v1}});
+}
+
+void Renderer::drawPlantField(sf::RenderWindow& window, const PlantField& field, sf::Vector2f min, sf::Vector2f max) {
+    sf::Vector2u size((unsigned)field.cols(), (unsigned)field.rows());
+    if (m_fieldTexture.getSize() != size) {
+        if (!m_fieldTexture.resize(size)) { std::cerr << "Renderer : texture du champ impossible" << std::endl; return; }
+        m_fieldTexture.setSmooth(true); // Transitions douces entre cellules
+    }
+
+    // Cellules visibles seulement : [c0, c1[ x [r0, r1[
+    auto cellRange = [&](float lo, float hi, float origin, int count) {
+        float inv = 1.f / field.cellSize();
+        int a = std::clamp((int)std::floor((lo - origin) * inv), 0, count);
+        int b = std::clamp((int)std::ceil((hi - origin) * inv), 0, count);
+        return std::make_pair(a, b);
+    };
+    auto [c0, c1] = cellRange(min.x, max.x, field.origin().x, field.cols());
+    auto [r0, r1] = cellRange(min.y, max.y, field.origin().y, field.rows());
+    if (c0 >= c1 || r0 >= r1) return;
+    sf::Vector2u shown((unsigned)(c1 - c0), (unsigned)(r1 - r0));
+
+    // Vert de plus en plus dense avec la biomasse, transparent sur les cellules vides
+    const std::vector<std::uint8_t>& cells = field.cells();
+    m_fieldPixels.resize((std::size_t)shown.x * shown.y * 4);
+    std::uint8_t* px = m_fieldPixels.data();
+    for (int r = r0; r < r1; ++r) {
+        for (int c = c0; c < c1; ++c, px += 4) {
+            std::uint8_t b = cells[(std::size_t)r * field.cols() + c];
+            px[0] = 40; px[1] = (std::uint8_t)(150 + 20 * b); px[2] = 40;
+            px[3] = (std::uint8_t)(b * 230 / PlantField::MAX_BIOMASS);
+        }
+    }
+    m_fieldTexture.update(m_fieldPixels.data(), shown, {(unsigned)c0, (unsigned)r0});
+
+    sf::Sprite sprite(m_fieldTexture, sf::IntRect({c0, r0}, {c1 - c0, r1 - r0}));
+    sprite.setPosition(field.origin() + sf::Vector2f(c0 * field.cellSize(), r0 * field.cellSize()));
+    sprite.setScale({field.cellSize(), field.cellSize()});
+    window.draw(sprite);
+}
+
+void Renderer::drawDensity(sf::RenderWindow& window, const RenderScene& scene) {
+    // Relecture : pas de grille fournie, on compte les colonnes de l'image affichée
+    // (une fois par image : en pause, ou à 60 images par seconde affichées 144 fois, rien à refaire)
+    const DensityGrid* grid = scene.density;
+    if (!grid) {
+        sf::Vector2f min = scene.bounds.position, max = scene.bounds.position + scene.bounds.size;
+        bool stale = scene.frame == 0 || scene.frame != m_sceneDensityFrame;
+        if (!m_sceneDensity.covers(min.x, max.x, min.y, max.y)) { m_sceneDensity.reset(min.x, max.x, min.y, max.y); stale = true; }
+        if (stale) m_sceneDensity.bin(scene.plantModel, *scene.plants, *scene.field, *scene.prey, *scene.sharks);
+        m_sceneDensityFrame = scene.frame;
+        grid = &m_sceneDensity;
+    }
+
+    sf::Vector2u size((unsigned)grid->cols(), (unsigned)grid->rows());
+    if (m_densityTexture.getSize() != size) {
+        if (!m_densityTexture.resize(size)) { std::cerr << "Renderer : texture des densites impossible" << std::endl; return; }
+        m_densityTexture.setSmooth(true);
+        m_shownDensity = nullptr;
+    }
+
+    // Texture réécrite seulement si les comptes ont changé (monde en pause : rien à faire)
+    if (grid != m_shownDensity || grid->version() != m_shownVersion) {
+        // Couleur de chaque espèce (celle de ses sprites ; requins éclaircis pour ressortir sur le bleu)
+        static const sf::Color LAYER_COLORS[DensityGrid::LAYER_COUNT] = {
+            sf::Color(50, 200, 50), sf::Color(0, 255, 100), sf::Color(0, 150, 255), sf::Color(230, 230, 245)};
+
+        // Échelle logarithmique : une cellule isolée reste visible à côté d'un banc dense
+        float invLogPeak[DensityGrid::LAYER_COUNT];
+        for (int l = 0; l < DensityGrid::LAYER_COUNT; ++l) {
+            std::uint32_t peak = grid->peak((DensityGrid::Layer)l);
+            invLogPeak[l] = peak ? 1.f / std::log1p((float)peak) : 0.f;
+        }
+
+        std::size_t cells = (std::size_t)size.x * size.y;
+        m_densityPixels.resize(cells * 4);
+        for (std::size_t c = 0; c < cells; ++c) {
+            // Teinte : moyenne des couleurs pondérée par la densité de chaque espèce
+            float r = 0.f, g = 0.f, b = 0.f, total = 0.f, strongest = 0.f;
+            for (int l = 0; l < DensityGrid::LAYER_COUNT; ++l) {
+                std::uint32_t count = grid->layer((DensityGrid::Layer)l)[c];
+                if (!count) continue;
+                float w = std::log1p((float)count) * invLogPeak[l];
+                r += LAYER_COLORS[l].r * w; g += LAYER_COLORS[l].g * w; b += LAYER_COLORS[l].b * w;
+                total += w;
+                strongest = std::max(strongest, w);
+            }
+            std::uint8_t* px = &m_densityPixels[c * 4];
+            if (total <= 0.f) { px[0] = px[1] = px[2] = px[3] = 0; continue; }
+            px[0] = (std::uint8_t)(r / total); px[1] = (std::uint8_t)(g / total); px[2] = (std::uint8_t)(b / total);
+            px[3] = (std::uint8_t)(60.f + 195.f * strongest);
+        }
+        m_densityTexture.update(m_densityPixels.data());
+        m_shownDensity = grid;
+        m_shownVersion = grid->version();
+    }
+
+    sf::Sprite sprite(m_densityTexture);
+    sprite.setPosition(grid->origin());
+    sprite.setScale({grid->cellSize(), grid->cellSize()});
+    window.draw(sprite);
+}
+
+void Renderer::drawEcosystem(sf::RenderWindow& window, const RenderScene& scene) {
+    m_batch.clear();
+
+    // Région visible, élargie de la taille d'un sprite
+    sf::FloatRect visible = m_camera.visibleArea();
+    sf::Vector2f min = visible.position - sf::Vector2f(CULL_MARGIN, CULL_MARGIN);
+    sf::Vector2f max = visible.position + visible.size + sf::Vector2f(CULL_MARGIN, CULL_MARGIN);
+    auto onScreen = [&](sf::Vector2f p) { return p.x >= min.x && p.x <= max.x && p.y >= min.y && p.y <= max.y; };
+
+    // Plantes : champ (une texture), ou tige + deux feuilles par algue (l'ordre d'ajout est l'ordre de dessin)
+    if (scene.plantModel == PlantModel::Field) {
+        drawPlantField(window, *scene.field, min, max);
+    } else {
+        auto addPlant = [&](sf::Vector2f p) {
+            if (!onScreen(p)) return;
+            appendSprite(p, 4.f, sf::Color(50, 200, 50), SPRITE_DISC);
+            appendSprite({p.x - 4.f, p.y + 2.f}, 3.f, sf::Color(30, 180, 30), SPRITE_DISC);
+            appendSprite({p.x + 4.f, p.y + 2.f}, 3.f, sf::Color(70, 220, 70), SPRITE_DISC);
+        };
+        const std::vector<Grass>& plants = *scene.plants;
+        if (scene.plantRegions) scene.plantRegions->forEachIn(min, max, [&](std::uint32_t i) { addPlant(plants[i].pos); });
+        else for (const Grass& p : plants) if (p.alive) addPlant(p.pos);
+    }
+
+    // Position affichée : interpolée depuis l'image précédente quand la scène le permet
+    auto shownPos = [&](const Population& pop, const std::vector<sf::Vector2f>* from, std::size_t i) {
+        if (!from) return pop.pos(i);
+        sf::Vector2f a = (*from)[i];
+        return a + (pop.pos(i) - a) * scene.alpha;
+    };
+
+    // Proies : la couleur dépend du stade
+    const Population& prey = *scene.prey;
+    auto addPrey = [&](std::size_t i) {
+        if (!prey.alive[i]) return;
+        sf::Vector2f p = shownPos(prey, scene.preyFrom, i);
+        if (!onScreen(p)) return;
+        sf::Color color = (prey.level[i] >= 2) ? sf::Color(0, 150, 255)        // Poisson : bleu
+                                                : sf::Color(0, 255, 100, 150); // Bactérie : vert translucide
+        appendSprite(p, prey.radius[i], color, SPRITE_DISC);
+    };
+    if (scene.preyRegions) scene.preyRegions->forEachIn(min, max, addPrey);
+    else for (std::size_t i = 0; i < prey.size(); ++i) addPrey(i);
+
+    // Requins : gris, contour noir de 2px intégré à la case de l'atlas
+    const Population& sharks = *scene.sharks;
+    auto addShark = [&](std::size_t i) {
+        if (!sharks.alive[i]) return;
+        sf::Vector2f p = shownPos(sharks, scene.sharksFrom, i);
+        if (!onScreen(p)) return;
+        appendSprite(p, sharks.radius[i] + 2.f, sf::Color(100, 100, 120), SPRITE_SHARK);
+    };
+    if (scene.sharkRegions) scene.sharkRegions->forEachIn(min, max, addShark);
+    else for (std::size_t i = 0; i < sharks.size(); ++i) addShark(i);
+
+    // Un seul appel de dessin pour toutes les entités
+    window.draw(m_batch, sf::RenderStates(&m_atlas));
 }
 
 // -------------------------------------------------------------------------
@@ -61,4 +299,5 @@ void Renderer::onResize(sf::Vector2u newSize, float hudWidth) {
 
     m_gameArea.setPosition(sf::Vector2f(posX, posY));
     m_gameArea.setSize(sf::Vector2f(w, h));
+    m_camera.setArea(sf::FloatRect({posX, posY}, {w, h}), newSize);
 }
\ No newline at end of file
@@ -0,0 +1,25 @@
+/**
+ * @file bench_main.cpp
+ * @author Sasha Marie te Rehorst (sasha.marieterehorst@gmail.com)
+ * @author Gael Guinaliu (rodez.gael@gmail.com)
+ * @brief Point d'entrée de Spore2D_bench (banc d'essai sans fenêtre).
+ * @version 1.0
+ * @date 2026-01-14
+ */
+
+/**
+ * @brief Fonction principale du banc d'essai.
+ * @return int (0 = Succès, 1 = Echec).
+ */
+int main(int argc, char* argv[]) {
+    BenchOptions options;
+    if (!parseBenchArgs(argc, argv, options)) {
+        printBenchUsage(argv[0]);
+        return 1;
+    }
+    if (options.showHelp) {
+        printBenchUsage(argv[0]);
+        return 0;
+    }
+    return runBench(options);
+}
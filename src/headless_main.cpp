@@ -0,0 +1,27 @@
+/**
+ * @file headless_main.cpp
+ * @author Sasha Marie te Rehorst (sasha.marieterehorst@gmail.com)
+ * @author Gael Guinaliu (rodez.gael@gmail.com)
+ * @brief Point d'entrée de Spore2D_headless (simulation sans fenêtre).
+ * @details Ne dépend ni de la fenêtre ni du rendu SFML : utilisable sur des
+ * nœuds de calcul sans affichage et par CTest.
+ * @version 1.0
+ * @date 2026-01-10
+ */
+
+/**
+ * @brief Fonction principale du mode sans affichage.
+ * @return int (0 = Succès, 1 = Echec).
+ */
+int main(int argc, char* argv[]) {
+    HeadlessOptions options;
+    if (!parseHeadlessArgs(argc, argv, options)) {
+        printHeadlessUsage(argv[0]);
+        return 1;
+    }
+    if (options.showHelp) {
+        printHeadlessUsage(argv[0]);
+        return 0;
+    }
+    return runHeadless(options);
+}
@@ -23,18 +23,54 @@ int main(int argc, char* argv[]){
     // Mode test
     bool testMode = false;
 
-    // Si on a un argument et que c'est "--test"
-    if (argc > 1 && std::string(argv[1]) == "--test") {
-        testMode = true;
+    // Options : "--test", "--plant-field" pour un champ d'algues (biomasse par cellule),
+    // "--load FICHIER" pour reprendre une sauvegarde, "--record FICHIER" pour enregistrer
+    // les trajectoires, "--play FICHIER" pour relire un enregistrement et "--world LxH"
+    // pour un monde plus grand que l'écran (molette et glisser pour s'y déplacer), "--lod SEUIL"
+    // pour le zoom (pixels par unité du monde) sous lequel les densités remplacent les sprites,
+    // "--seed N" pour rejouer un départ (par défaut : graine tirée de l'horloge)
+    std::string loadPath, recordPath, playPath;
+    unsigned int seed = static_cast<unsigned int>(std::time(nullptr));
+    sf::Vector2f worldSize;
+    float lodThreshold = Renderer::DEFAULT_LOD_THRESHOLD;
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--test") testMode = true;
+        else if (arg == "--plant-field") setPlantModel(PlantModel::Field);
+        else if (arg == "--load" && i + 1 < argc) loadPath = argv[++i];
+        else if (arg == "--record" && i + 1 < argc) recordPath = argv[++i];
+        else if (arg == "--play" && i + 1 < argc) playPath = argv[++i];
+        else if (arg == "--seed" && i + 1 < argc) seed = (unsigned int)std::strtoul(argv[++i], nullptr, 10);
+        else if (arg == "--lod" && i + 1 < argc) lodThreshold = std::max(0.f, std::strtof(argv[++i], nullptr));
+        else if (arg == "--world" && i + 1 < argc) {
+            std::string size = argv[++i];
+            std::size_t x = size.find('x');
+            float w = 0.f, h = 0.f;
+            try {
+                if (x != std::string::npos) { w = std::stof(size.substr(0, x)); h = std::stof(size.substr(x + 1)); }
+            } catch (const std::exception&) {}
+            if (w <= 0.f || h <= 0.f) {
+                std::cerr << "--world attend LARGEURxHAUTEUR (ex : 50000x50000)" << std::endl;
+                return 1;
+            }
+            worldSize = {w, h};
+        }
     }
 
     // Démarrage de la simulation + Message Debuggage.
     std::cout << "Lancement de la simulation..." << std::endl;
+    std::cout << "Memoire par agent : " << Population::BYTES_PER_ENTITY << " octets" << std::endl;
+    std::cout << "Graine : " << seed << " (--seed " << seed << " pour rejouer ce depart)" << std::endl;
 
     // Création de l'objet Application.
     // On reprend la classe depuis le header.
-    // Et en paramètre si c'est en test mode ou non
-    Application app(testMode);
+    // Et en paramètre si c'est en test mode ou non, et la graine du monde
+    Application app(testMode, seed);
+    if (worldSize.x > 0.f) app.setWorldSize(worldSize);
+    app.setLodThreshold(lodThreshold);
+    if (!loadPath.empty() && !app.load(loadPath)) return 1;
+    if (!recordPath.empty() && !app.record(recordPath)) return 1;
+    if (!playPath.empty() && !app.play(playPath)) return 1;
 
     // Lancement du moteur du jeu.
     // On appelle la méthode "run" de la classe "Application"